@@ -1,15 +1,17 @@
-//After v3.0.0 this is no longer used
+// North American OpenWeather city IDs with their coordinates, sorted by
+// city_code. Entries without coordinates are left out, those IDs are
+// resolved over the network.
+// Input for make_city_table.py, the library uses src/CityTable.h.
 
 typedef const struct NA {
 int city_code;
 float lat, lon;
 } cities;
 
-#define TABLE_SIZE 2000
+#define TABLE_SIZE 1991
 
-cities ht[TABLE_SIZE] = {
+static constexpr cities ht[TABLE_SIZE] PROGMEM = {
 
-	{921660,0.000000,0.000000},
 	{3482886,22.533331,-98.150002},
 	{3482929,22.833330,-98.433327},
 	{3483197,24.850000,-98.150002},
@@ -2001,5 +2003,4 @@ cities ht[TABLE_SIZE] = {
 	{7910166,55.915642,-61.124149},
 	{7910366,44.450001,-76.083328},
 	{8199578,20.580721,-100.492973},
-	{82188,0.000000,0.000000},
 };
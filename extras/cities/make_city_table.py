@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""
+make_city_table.py
+Writes src/CityTable.h, the offline city table used by src/CityIndex.cpp.
+
+Cities are sorted by ID and stored in three parts:
+  - IDs: blocks of CITY_BLOCK entries. Each block keeps its first ID and
+    the offset of the rest in cityIdDeltas, the differences to the
+    previous ID as varints (7 bits per byte, high bit set when another
+    byte follows). A lookup binary searches the blocks and decodes at
+    most CITY_BLOCK - 1 deltas.
+  - Coordinates: latitude and longitude as little-endian int24 at 1e-4
+    degree (about 11 m), 6 bytes per city at a fixed position.
+  - Grid: the bounding box in square cells of --step degrees, cell
+    (row, col) lists the table indexes of the cities inside it, see
+    nearestCity().
+
+The default input is extras/cities/NAComplete.h (North America). With
+--cities the table is built from OpenWeather's city.list.json
+(bulk.openweathermap.org/sample/city.list.json.gz) instead, optionally
+cut down to --bounds, names included.
+
+City names are optional for NAComplete.h. With --names pointing at
+city.list.json the name, state and country of every ID go in as well,
+read through cityName() in CityIndex.h. The shipped table has no names,
+so the library has no offline reverse geocode mode yet.
+
+usage: python3 make_city_table.py [--step DEGREES] [--names city.list.json]
+       python3 make_city_table.py --cities city.list.json [--bounds S,W,N,E] [--step DEGREES]
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TABLE = os.path.join(HERE, 'NAComplete.h')
+OUTPUT = os.path.join(HERE, '..', '..', 'src', 'CityTable.h')
+
+BLOCK = 32
+SCALE = 10000
+INT24 = 1 << 23
+
+
+def read_table(path):
+    rows = re.findall(r'\{(-?\d+),(-?[\d.]+),(-?[\d.]+)\}', open(path).read())
+    return [(int(i), float(lat), float(lon)) for i, lat, lon in rows]
+
+
+def read_city_list(path):
+    return json.load(open(path, encoding='utf-8'))
+
+
+def names_for(entries, cities):
+    known = {}
+    for entry in entries:
+        known[entry['id']] = entry
+    names = []
+    for city_id, _, _ in cities:
+        entry = known.get(city_id, {})
+        names.append((entry.get('name', ''), entry.get('state', ''), entry.get('country', '')))
+    return names
+
+
+def c_string(text):
+    out = ''
+    for ch in text.encode('utf-8'):
+        out += chr(ch) if 32 <= ch < 127 and ch not in (34, 92) else '\\%03o' % ch
+    return out
+
+
+def varint(value):
+    out = []
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return out
+
+
+def int24(value):
+    if not -INT24 <= value < INT24:
+        raise SystemExit('coordinate %d out of int24 range' % value)
+    value &= 0xFFFFFF
+    return [value & 0xFF, (value >> 8) & 0xFF, value >> 16]
+
+
+def encode_ids(ids):
+    blocks = []
+    deltas = []
+    for start in range(0, len(ids), BLOCK):
+        blocks.append((ids[start], len(deltas)))
+        for i in range(start + 1, min(start + BLOCK, len(ids))):
+            deltas += varint(ids[i] - ids[i - 1])
+    return blocks, deltas
+
+
+def decode_id(blocks, deltas, index):
+    value, offset = blocks[index // BLOCK]
+    for _ in range(index % BLOCK):
+        delta, shift = 0, 0
+        while True:
+            byte = deltas[offset]
+            offset += 1
+            delta |= (byte & 0x7F) << shift
+            shift += 7
+            if byte < 0x80:
+                break
+        value += delta
+    return value
+
+
+def emit_bytes(out, name, size, data, per_line=24):
+    out.append('static constexpr uint8_t %s[%s] PROGMEM = {' % (name, size))
+    for i in range(0, len(data), per_line):
+        out.append('\t' + ','.join(str(b) for b in data[i:i + per_line]) + ',')
+    out.append('};')
+
+
+def emit_words(out, name, size, data, kind):
+    out.append('static constexpr %s %s[%s] PROGMEM = {' % (kind, name, size))
+    for i in range(0, len(data), 16):
+        out.append('\t' + ','.join(str(v) for v in data[i:i + 16]) + ',')
+    out.append('};')
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--step', type=int, default=3)
+    parser.add_argument('--names')
+    parser.add_argument('--cities')
+    parser.add_argument('--bounds')
+    args = parser.parse_args()
+
+    names = None
+    if args.cities:
+        entries = read_city_list(args.cities)
+        if args.bounds:
+            south, west, north, east = (float(v) for v in args.bounds.split(','))
+            entries = [e for e in entries if south <= e['coord']['lat'] <= north and west <= e['coord']['lon'] <= east]
+        cities = [(e['id'], e['coord']['lat'], e['coord']['lon']) for e in entries]
+        source = os.path.basename(args.cities)
+    else:
+        entries = read_city_list(args.names) if args.names else None
+        cities = read_table(TABLE)
+        source = os.path.basename(TABLE)
+
+    # (0, 0) means the list has no position for the ID
+    cities = sorted(c for c in cities if c[1] or c[2])
+    ids = [c[0] for c in cities]
+    if len(set(ids)) != len(ids):
+        raise SystemExit('duplicate city IDs')
+    if entries is not None:
+        names = names_for(entries, cities)
+
+    # Grid over the quantized positions, the same ones nearestCity() sees
+    points = [(round(lat * SCALE) / SCALE, round(lon * SCALE) / SCALE) for _, lat, lon in cities]
+    lat0 = math.floor(min(p[0] for p in points) / args.step) * args.step
+    lon0 = math.floor(min(p[1] for p in points) / args.step) * args.step
+    rows = int((max(p[0] for p in points) - lat0) // args.step) + 1
+    cols = int((max(p[1] for p in points) - lon0) // args.step) + 1
+
+    cells = [[] for _ in range(rows * cols)]
+    for index, (lat, lon) in enumerate(points):
+        row = int((lat - lat0) // args.step)
+        col = int((lon - lon0) // args.step)
+        cells[row * cols + col].append(index)
+
+    starts = [0]
+    for cell in cells:
+        starts.append(starts[-1] + len(cell))
+    entries_in_cells = [index for cell in cells for index in cell]
+    index_type = 'uint16_t' if len(cities) <= 0xFFFF else 'uint32_t'
+
+    blocks, deltas = encode_ids(ids)
+    assert all(decode_id(blocks, deltas, i) == ids[i] for i in range(len(ids)))
+
+    coords = []
+    for _, lat, lon in cities:
+        coords += int24(round(lat * SCALE)) + int24(round(lon * SCALE))
+
+    out = []
+    out.append('// Generated by extras/cities/make_city_table.py from %s, do not edit.' % source)
+    out.append('// Only CityIndex.cpp includes this file.')
+    out.append('')
+    out.append('#define CITY_TABLE_SIZE %d' % len(cities))
+    out.append('#define CITY_BLOCK %d' % BLOCK)
+    out.append('#define CITY_COORD_SCALE %d // 1e-4 degree' % SCALE)
+    out.append('')
+    out.append('typedef %s city_index_t;' % index_type)
+    out.append('')
+    out.append('// First ID of every CITY_BLOCK cities and where the rest start in cityIdDeltas')
+    out.append('static constexpr CityBlock cityBlocks[%d] PROGMEM = {' % len(blocks))
+    for i in range(0, len(blocks), 6):
+        out.append('\t' + ','.join('{%d,%d}' % b for b in blocks[i:i + 6]) + ',')
+    out.append('};')
+    out.append('')
+    out.append('// Difference to the previous ID, 7 bits per byte, high bit when more follow')
+    emit_bytes(out, 'cityIdDeltas', len(deltas), deltas)
+    out.append('')
+    out.append('// Latitude, longitude of city i at [6 * i], little-endian int24')
+    emit_bytes(out, 'cityCoords', 'CITY_TABLE_SIZE * 6', coords)
+    out.append('')
+    out.append('#define CITY_GRID_LAT0 %d' % lat0)
+    out.append('#define CITY_GRID_LON0 %d' % lon0)
+    out.append('#define CITY_GRID_STEP %d' % args.step)
+    out.append('#define CITY_GRID_ROWS %d' % rows)
+    out.append('#define CITY_GRID_COLS %d' % cols)
+    out.append('')
+    out.append('// Cell row * CITY_GRID_COLS + col holds cityGridEntries[start[cell]..start[cell + 1]]')
+    emit_words(out, 'cityGridStart', 'CITY_GRID_ROWS * CITY_GRID_COLS + 1', starts, 'city_index_t')
+    out.append('')
+    emit_words(out, 'cityGridEntries', 'CITY_TABLE_SIZE', entries_in_cells, 'city_index_t')
+    out.append('')
+
+    if names:
+        out.append('#define CITY_NAMES 1')
+        out.append('')
+        out.append('// name, state, country of city i')
+        out.append('static constexpr CityName cityNames[CITY_TABLE_SIZE] PROGMEM = {')
+        for name, state, country in names:
+            out.append('\t{"%s","%s","%s"},' % (c_string(name), c_string(state[:2]), c_string(country[:2])))
+        out.append('};')
+    else:
+        out.append('#define CITY_NAMES 0 // Generate with --names for cityName()')
+    out.append('')
+
+    with open(OUTPUT, 'w', newline='') as f:
+        f.write('\r\n'.join(out))
+
+    packed = len(blocks) * 8 + len(deltas) + len(coords) + (len(starts) + len(entries_in_cells)) * (2 if index_type == 'uint16_t' else 4)
+    print('%s: %d cities, %d bytes (ids %d, coordinates %d), %d x %d cells of %d degrees'
+          % (os.path.normpath(OUTPUT), len(cities), packed, len(blocks) * 8 + len(deltas), len(coords), rows, cols, args.step))
+
+
+if __name__ == '__main__':
+    main()
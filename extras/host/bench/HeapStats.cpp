@@ -0,0 +1,122 @@
+/*
+   HeapStats.cpp
+   glibc allocator interposition behind HeapTracker, see HeapStats.h
+*/
+
+#include "HeapStats.h"
+#include <stdlib.h>
+
+#ifdef __GLIBC__
+
+#include <malloc.h>
+#include <string.h>
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+static bool tracking = false;
+static HeapStats counters;
+static long long liveBytes = 0; // may dip below zero when older blocks are freed
+static long long peakBytes = 0;
+
+static void recordAlloc(void *ptr)
+{
+    liveBytes += (long long)malloc_usable_size(ptr);
+    if(liveBytes > peakBytes) peakBytes = liveBytes;
+}
+
+static void recordFree(void *ptr)
+{
+    liveBytes -= (long long)malloc_usable_size(ptr);
+}
+
+extern "C" void *malloc(size_t size)
+{
+    void *ptr = __libc_malloc(size);
+    if(tracking && ptr)
+        {
+            counters.mallocCalls++;
+            counters.bytesAllocated += size;
+            recordAlloc(ptr);
+        }
+    return ptr;
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    void *ptr = __libc_calloc(count, size);
+    if(tracking && ptr)
+        {
+            counters.mallocCalls++;
+            counters.bytesAllocated += count * size;
+            recordAlloc(ptr);
+        }
+    return ptr;
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    if(tracking && ptr) recordFree(ptr);
+    void *moved = __libc_realloc(ptr, size);
+    if(tracking)
+        {
+            counters.reallocCalls++;
+            counters.bytesAllocated += size;
+            if(moved) recordAlloc(moved);
+        }
+    return moved;
+}
+
+extern "C" void free(void *ptr)
+{
+    if(tracking && ptr)
+        {
+            counters.freeCalls++;
+            recordFree(ptr);
+        }
+    __libc_free(ptr);
+}
+
+namespace HeapTracker
+{
+void start(void)
+{
+    memset(&counters, 0, sizeof(counters));
+    liveBytes = 0;
+    peakBytes = 0;
+    tracking = true;
+}
+
+HeapStats stop(void)
+{
+    tracking = false;
+    counters.liveBytes = liveBytes > 0 ? (size_t)liveBytes : 0;
+    counters.peakBytes = (size_t)peakBytes;
+    return counters;
+}
+
+bool available(void)
+{
+    return true;
+}
+}
+
+#else
+
+namespace HeapTracker
+{
+void start(void) {}
+HeapStats stop(void)
+{
+    HeapStats none = {};
+    return none;
+}
+bool available(void)
+{
+    return false;
+}
+}
+
+#endif
@@ -0,0 +1,29 @@
+/*
+   HeapStats.h
+   Counts heap traffic of the benchmarked code by interposing the glibc
+   malloc family (operator new ends up there as well).
+*/
+
+#ifndef _OWOC_HEAPSTATS_H
+#define _OWOC_HEAPSTATS_H
+
+#include <stddef.h>
+
+struct HeapStats
+{
+    unsigned long mallocCalls;  // malloc + calloc
+    unsigned long reallocCalls;
+    unsigned long freeCalls;
+    size_t bytesAllocated;      // requested bytes, realloc counts its new size
+    size_t liveBytes;           // outstanding since start()
+    size_t peakBytes;           // high water mark of liveBytes since start()
+};
+
+namespace HeapTracker
+{
+void start(void);               // zero the counters and begin tracking
+HeapStats stop(void);           // stop tracking and return the counters
+bool available(void);           // false when the allocator could not be interposed
+}
+
+#endif
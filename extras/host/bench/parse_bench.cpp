@@ -0,0 +1,218 @@
+/*
+   parse_bench.cpp
+   Parse throughput of every create* path over the recorded corpus.
+   Reports time per parse, heap traffic per parse and the peak heap
+   held while parsing. Run it before and after a change to compare.
+
+   usage: owoc_parse_bench [-n iterations] [payload directory]
+*/
+
+#include <OpenWeatherOneCall.h>
+#include "HeapStats.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+#ifndef OWOC_PAYLOAD_DIR
+#define OWOC_PAYLOAD_DIR "payloads"
+#endif
+
+static volatile float benchSink;
+
+// Friend of OpenWeatherOneCall (host builds only)
+struct OpenWeatherOneCallProbe
+{
+    static void excludes(OpenWeatherOneCall &OWOC, int _EXCL)
+    {
+        OWOC.exclude.all_excludes = _EXCL;
+    }
+    static int current(OpenWeatherOneCall &OWOC)
+    {
+        return OWOC.createCurrent();
+    }
+    static int currentStream(OpenWeatherOneCall &OWOC)
+    {
+        OWOC.setParser(STREAM_PARSER);
+        return OWOC.createCurrent();
+    }
+    static int currentArena(OpenWeatherOneCall &OWOC)
+    {
+        OWOC.setParser(STREAM_PARSER);
+        if(!OWOC.getArenaUsed()) OWOC.setArena((size_t)65536);
+        OWOC.resetArena();
+        return OWOC.createCurrent();
+    }
+    // A display that shows 3 days and 12 hours
+    static int currentHorizon(OpenWeatherOneCall &OWOC)
+    {
+        OWOC.setHorizon(3, 12, ONECALL_MINUTES);
+        return OWOC.createCurrent();
+    }
+    static int currentStreamHorizon(OpenWeatherOneCall &OWOC)
+    {
+        OWOC.setParser(STREAM_PARSER);
+        return currentHorizon(OWOC);
+    }
+    // First call parses, the timed ones only format the readable dates
+    static int dates(OpenWeatherOneCall &OWOC)
+    {
+        if(!OWOC.current) return OWOC.createCurrent();
+        OWOC.formatOneCallDates();
+        return 0;
+    }
+    // A dashboard frame: temperature range and mean, wettest hour, first
+    // likely rain, rain in the next hour. First call parses.
+    static int framesStructs(OpenWeatherOneCall &OWOC)
+    {
+        if(!OWOC.hour) return OWOC.createCurrent();
+        float low = WEATHER_FLOAT(OWOC.hour[0].temperature), high = low, total = 0, rain = 0;
+        int wettest = 0, likely = -1;
+        for(int h = 0; h < 48; h++)
+            {
+                float t = WEATHER_FLOAT(OWOC.hour[h].temperature);
+                low = (t < low) ? t : low;
+                high = (t > high) ? t : high;
+                total += t;
+                if(OWOC.hour[h].pop > OWOC.hour[wettest].pop) wettest = h;
+                if((likely < 0) && (WEATHER_FLOAT(OWOC.hour[h].pop) > 0.5f)) likely = h;
+            }
+        for(int m = 0; m < 61; m++) rain += WEATHER_FLOAT(OWOC.minute[m].precipitation);
+        benchSink = low + high + total / 48 + wettest + likely + rain;
+        return 0;
+    }
+    static int framesSeries(OpenWeatherOneCall &OWOC)
+    {
+        if(!OWOC.series)
+            {
+                OWOC.setSeries(SERIES_ON);
+                return OWOC.createCurrent();
+            }
+        const WeatherSeries &s = *OWOC.series;
+        benchSink = seriesMin(s.temperature, s.hours) + seriesMax(s.temperature, s.hours) + seriesMean(s.temperature, s.hours) +
+                    seriesArgMax(s.pop, s.hours) + seriesFirstAbove(s.pop, s.hours, 0.5f) + seriesSum(s.precipitation, s.minutes);
+        return 0;
+    }
+    static int history(OpenWeatherOneCall &OWOC)
+    {
+        return OWOC.createHistory();
+    }
+    static int airQuality(OpenWeatherOneCall &OWOC)
+    {
+        return OWOC.createAQ(OWOC.session, OWOC.location.timezoneOffset);
+    }
+    // Every call a new place: a LocationCache hit would skip the request and the parse
+    static int locationInfo(OpenWeatherOneCall &OWOC)
+    {
+        OWOC.getLocationCache()->clear();
+        return OWOC.getLocationInfo();
+    }
+    static int cityCoordinates(OpenWeatherOneCall &OWOC)
+    {
+        char cityURL[] = "http://api.openweathermap.org/data/3.0/weather?id=4504476&appid=0123456789abcdef0123456789abcdef";
+        return OWOC.parseCityCoordinates(cityURL);
+    }
+};
+
+typedef int (*ParsePath)(OpenWeatherOneCall &OWOC);
+
+struct BenchCase
+{
+    const char *name;
+    const char *body;       // corpus body for the One Call route, NULL keeps the default
+    int excludes;           // sections missing from the body
+    ParsePath run;
+};
+
+static const BenchCase benchCases[] =
+{
+    {"createCurrent small", "corpus/small.json", EXCL_D + EXCL_H + EXCL_M + EXCL_A, OpenWeatherOneCallProbe::current},
+    {"createCurrent typical", "corpus/typical.json", 0, OpenWeatherOneCallProbe::current},
+    {"createCurrent alert_heavy", "corpus/alert_heavy.json", 0, OpenWeatherOneCallProbe::current},
+    {"createCurrent minutely_heavy", "corpus/minutely_heavy.json", 0, OpenWeatherOneCallProbe::current},
+    {"createCurrent typical, current only", "corpus/typical.json", EXCL_D + EXCL_H + EXCL_M + EXCL_A, OpenWeatherOneCallProbe::current},
+    {"createCurrent small, stream", "corpus/small.json", EXCL_D + EXCL_H + EXCL_M + EXCL_A, OpenWeatherOneCallProbe::currentStream},
+    {"createCurrent typical, stream", "corpus/typical.json", 0, OpenWeatherOneCallProbe::currentStream},
+    {"createCurrent alert_heavy, stream", "corpus/alert_heavy.json", 0, OpenWeatherOneCallProbe::currentStream},
+    {"createCurrent minutely_heavy, stream", "corpus/minutely_heavy.json", 0, OpenWeatherOneCallProbe::currentStream},
+    {"createCurrent typical, 3d/12h", "corpus/typical.json", 0, OpenWeatherOneCallProbe::currentHorizon},
+    {"createCurrent typical, stream, 3d/12h", "corpus/typical.json", 0, OpenWeatherOneCallProbe::currentStreamHorizon},
+    {"createCurrent typical, stream, arena", "corpus/typical.json", 0, OpenWeatherOneCallProbe::currentArena},
+    {"createCurrent alert_heavy, stream, arena", "corpus/alert_heavy.json", 0, OpenWeatherOneCallProbe::currentArena},
+    {"formatOneCallDates typical", "corpus/typical.json", 0, OpenWeatherOneCallProbe::dates},
+    {"hourly aggregates, structs", "corpus/typical.json", 0, OpenWeatherOneCallProbe::framesStructs},
+    {"hourly aggregates, series", "corpus/typical.json", 0, OpenWeatherOneCallProbe::framesSeries},
+    {"createHistory", NULL, 0, OpenWeatherOneCallProbe::history},
+    {"createAQ", NULL, 0, OpenWeatherOneCallProbe::airQuality},
+    {"getLocationInfo", NULL, 0, OpenWeatherOneCallProbe::locationInfo},
+    {"parseCityCoordinates", NULL, 0, OpenWeatherOneCallProbe::cityCoordinates},
+};
+
+static char benchKey[] = "0123456789abcdef0123456789abcdef";
+
+static long benchEpoch(void)
+{
+    return 1713988296;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 2000;
+    const char *payloads = OWOC_PAYLOAD_DIR;
+
+    for(int a = 1; a < argc; a++)
+        {
+            if(!strcmp(argv[a], "-n") && a + 1 < argc) iterations = atoi(argv[++a]);
+            else payloads = argv[a];
+        }
+    if(iterations < 1) iterations = 1;
+
+    setenv("TZ", "UTC0", 1);
+    tzset();
+
+    ReplayTransport replay(payloads);
+    replay.install();
+
+    printf("%d iterations per case%s\n\n", iterations, HeapTracker::available() ? "" : " (heap counters unavailable on this libc)");
+    printf("%-40s %9s %9s %11s %8s %8s %10s\n", "case", "bytes in", "us/parse", "alloc B/op", "malloc", "realloc", "peak heap");
+
+    for(size_t c = 0; c < sizeof(benchCases) / sizeof(benchCases[0]); c++)
+        {
+            const BenchCase &bench = benchCases[c];
+            replay.replace("/onecall", bench.body ? bench.body : "onecall.json");
+
+            OpenWeatherOneCall OWOC;
+            OWOC.setOpenWeatherKey(benchKey);
+            OWOC.setUnits(METRIC);
+            OWOC.setLatLon(51.685238f, 5.060593f);
+            OWOC.setHistory(1);
+            OWOC.getEpochTime(benchEpoch);
+            OpenWeatherOneCallProbe::excludes(OWOC, bench.excludes);
+
+            // Warm up: first parse allocates the result structs
+            HostTransport::resetStats();
+            int error_code = bench.run(OWOC);
+            unsigned long bytesIn = HostTransport::stats().bytes;
+            if(error_code)
+                {
+                    printf("%-40s failed with error %d\n", bench.name, error_code);
+                    continue;
+                }
+
+            HeapTracker::start();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for(int i = 0; i < iterations; i++)
+                {
+                    bench.run(OWOC);
+                }
+            std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+            HeapStats heap = HeapTracker::stop();
+
+            double usPerParse = std::chrono::duration<double, std::micro>(finish - start).count() / iterations;
+            printf("%-40s %9lu %9.2f %11.0f %8.1f %8.1f %10zu\n", bench.name, bytesIn, usPerParse,
+                   (double)heap.bytesAllocated / iterations, (double)heap.mallocCalls / iterations,
+                   (double)heap.reallocCalls / iterations, heap.peakBytes);
+        }
+
+    return 0;
+}
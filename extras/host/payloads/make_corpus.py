@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+make_corpus.py
+Writes the One Call bodies used by the host benchmark into corpus/.
+Shapes follow recorded api.openweathermap.org/data/3.0/onecall responses;
+values are seeded pseudo-random so the corpus is reproducible.
+
+    small           current only (exclude=minutely,hourly,daily,alerts)
+    typical         current, 61 minutely, 48 hourly, 8 daily, 1 alert
+    alert_heavy     typical plus 10 long alerts
+    minutely_heavy  typical with precipitation in every minute
+
+usage: python3 make_corpus.py [output directory]
+"""
+
+import json
+import os
+import random
+import sys
+
+CONDITIONS = [
+    (800, "Clear", "clear sky", "01"),
+    (801, "Clouds", "few clouds", "02"),
+    (802, "Clouds", "scattered clouds", "03"),
+    (803, "Clouds", "broken clouds", "04"),
+    (804, "Clouds", "overcast clouds", "04"),
+    (500, "Rain", "light rain", "10"),
+    (501, "Rain", "moderate rain", "10"),
+    (300, "Drizzle", "light intensity drizzle", "09"),
+    (600, "Snow", "light snow", "13"),
+    (701, "Mist", "mist", "50"),
+]
+
+EVENTS = ["Wind gusts", "Thunderstorms", "Slippery roads", "Heavy rain", "Fog"]
+
+ALERT_TEXT = ("In the north of the country severe gusts of wind are expected from the west "
+              "to northwest of 75 to 90 km/h. This may cause damage to trees and disrupt traffic. ")
+
+START = 1713898800
+
+
+def rnd(rng, low, high):
+    return round(rng.uniform(low, high), 2)
+
+
+def weather(rng, suffix):
+    c = rng.choice(CONDITIONS)
+    return [{"id": c[0], "main": c[1], "description": c[2], "icon": c[3] + suffix}]
+
+
+def onecall(seed, minutes=61, hours=48, days=8, alerts=1, wet_minutes=False, long_alerts=False):
+    rng = random.Random(seed)
+    body = {"lat": 51.6852, "lon": 5.0606, "timezone": "Europe/Amsterdam", "timezone_offset": 7200}
+    body["current"] = {"dt": 1713900158, "sunrise": 1713846357, "sunset": 1713898183, "temp": 7.05,
+                       "feels_like": 4.6, "pressure": 1014, "humidity": 70, "dew_point": 1.96, "uvi": 0,
+                       "clouds": 75, "visibility": 10000, "wind_speed": 3.6, "wind_deg": 240, "wind_gust": 6.2,
+                       "weather": [{"id": 500, "main": "Rain", "description": "light rain", "icon": "10n"}],
+                       "rain": {"1h": 0.32}}
+    if minutes:
+        body["minutely"] = [{"dt": 1713900180 + 60 * i,
+                             "precipitation": round(rng.uniform(0.05, 4.5), 4) if wet_minutes or rng.random() < 0.4 else 0}
+                            for i in range(minutes)]
+    if hours:
+        hourly = []
+        for i in range(hours):
+            h = {"dt": START + 3600 * i, "temp": rnd(rng, 1, 14), "feels_like": rnd(rng, -2, 12),
+                 "pressure": rng.randint(1005, 1025), "humidity": rng.randint(40, 95), "dew_point": rnd(rng, -3, 6),
+                 "uvi": rnd(rng, 0, 4), "clouds": rng.randint(0, 100), "visibility": 10000,
+                 "wind_speed": rnd(rng, 0.5, 9), "wind_deg": rng.randint(0, 359), "wind_gust": rnd(rng, 1, 14),
+                 "weather": weather(rng, "d" if 6 <= i % 24 <= 20 else "n"), "pop": rnd(rng, 0, 1)}
+            if h["weather"][0]["main"] == "Rain":
+                h["rain"] = {"1h": rnd(rng, 0.1, 3)}
+            if h["weather"][0]["main"] == "Snow":
+                h["snow"] = {"1h": rnd(rng, 0.1, 2)}
+            hourly.append(h)
+        body["hourly"] = hourly
+    if days:
+        daily = []
+        for i in range(days):
+            d = {"dt": 1713870000 + 86400 * i, "sunrise": 1713846357 + 86400 * i, "sunset": 1713898183 + 86400 * i,
+                 "moonrise": 1713890000 + 86400 * i, "moonset": 1713850000 + 86400 * i, "moon_phase": rnd(rng, 0, 1),
+                 "summary": "Expect a day of partly cloudy with rain",
+                 "temp": {"day": rnd(rng, 6, 14), "min": rnd(rng, 0, 5), "max": rnd(rng, 10, 16),
+                          "night": rnd(rng, 2, 7), "eve": rnd(rng, 5, 11), "morn": rnd(rng, 1, 6)},
+                 "feels_like": {"day": rnd(rng, 4, 12), "night": rnd(rng, 0, 5), "eve": rnd(rng, 3, 9),
+                                "morn": rnd(rng, -1, 4)},
+                 "pressure": rng.randint(1005, 1025), "humidity": rng.randint(40, 95), "dew_point": rnd(rng, -3, 6),
+                 "wind_speed": rnd(rng, 1, 9), "wind_deg": rng.randint(0, 359), "wind_gust": rnd(rng, 2, 15),
+                 "weather": weather(rng, "d"), "clouds": rng.randint(0, 100), "pop": rnd(rng, 0, 1),
+                 "uvi": rnd(rng, 0, 5)}
+            if d["weather"][0]["main"] == "Rain":
+                d["rain"] = rnd(rng, 0.2, 12)
+            if d["weather"][0]["main"] == "Snow":
+                d["snow"] = rnd(rng, 0.2, 6)
+            daily.append(d)
+        body["daily"] = daily
+    if alerts:
+        body["alerts"] = [{"sender_name": "KNMI Koninklijk Nederlands Meteorologisch Instituut",
+                           "event": EVENTS[i % len(EVENTS)],
+                           "start": 1713916800 + 3600 * i, "end": 1713960000 + 3600 * i,
+                           "description": ALERT_TEXT * ((8 + i) if long_alerts else 1),
+                           "tags": ["Wind"]}
+                          for i in range(alerts)]
+    return body
+
+
+def main():
+    out = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), "corpus")
+    os.makedirs(out, exist_ok=True)
+    corpus = {
+        "small": onecall(1, minutes=0, hours=0, days=0, alerts=0),
+        "typical": onecall(2),
+        "alert_heavy": onecall(3, alerts=10, long_alerts=True),
+        "minutely_heavy": onecall(4, wet_minutes=True),
+    }
+    for name, body in corpus.items():
+        with open(os.path.join(out, name + ".json"), "w") as f:
+            json.dump(body, f, separators=(",", ":"))
+            f.write("\n")
+
+
+if __name__ == "__main__":
+    main()
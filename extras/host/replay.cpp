@@ -0,0 +1,242 @@
+/*
+   replay.cpp
+   Drives every parse path of OpenWeatherOneCall against recorded
+   response bodies and prints what ended up in the result structs.
+
+   usage: owoc_replay [--stream] [--arena] [--no-keepalive] [--async] [--concurrent] [--latency MS] [--cache] [--snapshot] [--static] [--series] [--horizon D,H,M] [--exclude MASK] [--format DTF] [payload directory]
+*/
+
+#include <OpenWeatherOneCall.h>
+#include <OpenWeatherOneCallT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef OWOC_PAYLOAD_DIR
+#define OWOC_PAYLOAD_DIR "payloads"
+#endif
+
+// The struct field, or the accessor when the library is built with OWOC_LAZY_DATES
+#ifdef OWOC_LAZY_DATES
+#define DATE_TEXT(field, accessor, epoch) OWOC.accessor(epoch)
+#else
+#define DATE_TEXT(field, accessor, epoch) field
+#endif
+// Text of forecast[x] and history[0], in forecastText/historyText when built with OWOC_SPLIT_RECORDS
+#ifdef OWOC_SPLIT_RECORDS
+#define FORECAST_TEXT(x) OWOC.forecastText[x]
+#define HISTORY_TEXT OWOC.historyText[0]
+#else
+#define FORECAST_TEXT(x) OWOC.forecast[x]
+#define HISTORY_TEXT OWOC.history[0]
+#endif
+// Weather values print the same from float and OWOC_FIXED_POINT builds through WEATHER_FLOAT()
+
+static char replayKey[] = "0123456789abcdef0123456789abcdef";
+
+static void printCurrent(OpenWeatherOneCall &OWOC)
+{
+    printf("location: %s, %s %s (%s %+d)\n", OWOC.location.CITY, OWOC.location.STATE, OWOC.location.COUNTRY, OWOC.location.timezone, OWOC.location.timezoneOffset);
+
+    if(OWOC.quality)
+        {
+            printf("quality: aqi %d co %.2f no2 %.2f pm2_5 %.2f at %s\n", OWOC.quality->aqi, OWOC.quality->co, OWOC.quality->no2, OWOC.quality->pm2_5,
+                   DATE_TEXT(OWOC.quality->readableDateTime, readableDateTime, OWOC.quality->dayTime));
+        }
+
+    if(OWOC.current)
+        {
+            printf("current: %s %s temp %.2f feels %.2f hum %.0f wind %.2f/%.0f rain %.3f id %.0f %s \"%s\" %s sun %s-%s\n",
+                   DATE_TEXT(OWOC.current->readableWeekdayName, readableWeekday, OWOC.current->dayTime),
+                   DATE_TEXT(OWOC.current->readableDateTime, readableDateTime, OWOC.current->dayTime), WEATHER_FLOAT(OWOC.current->temperature), WEATHER_FLOAT(OWOC.current->apparentTemperature),
+                   (float)OWOC.current->humidity, WEATHER_FLOAT(OWOC.current->windSpeed), (float)OWOC.current->windBearing, WEATHER_FLOAT(OWOC.current->rainVolume), (float)OWOC.current->id,
+                   OWOC.current->main, OWOC.current->summary, OWOC.current->icon,
+                   DATE_TEXT(OWOC.current->readableSunrise, readableTime, OWOC.current->sunriseTime),
+                   DATE_TEXT(OWOC.current->readableSunset, readableTime, OWOC.current->sunsetTime));
+        }
+
+    if(OWOC.forecast)
+        {
+            for(int x = 0; x < OWOC.NUM_DAYS; x++)
+                {
+                    printf("daily[%d]: %s %s hi %.2f lo %.2f pop %.2f rain %.3f %s \"%s\" %s sun %s-%s\n", x,
+                           DATE_TEXT(FORECAST_TEXT(x).weekDayName, readableWeekday, OWOC.forecast[x].dayTime),
+                           DATE_TEXT(FORECAST_TEXT(x).readableDateTime, readableDateTime, OWOC.forecast[x].dayTime),
+                           WEATHER_FLOAT(OWOC.forecast[x].temperatureHigh), WEATHER_FLOAT(OWOC.forecast[x].temperatureLow), WEATHER_FLOAT(OWOC.forecast[x].pop), WEATHER_FLOAT(OWOC.forecast[x].rainVolume),
+                           FORECAST_TEXT(x).main, FORECAST_TEXT(x).summary, FORECAST_TEXT(x).icon,
+                           DATE_TEXT(FORECAST_TEXT(x).readableSunrise, readableTime, OWOC.forecast[x].sunriseTime),
+                           DATE_TEXT(FORECAST_TEXT(x).readableSunset, readableTime, OWOC.forecast[x].sunsetTime));
+                }
+        }
+
+    if(OWOC.hour)
+        {
+            for(int h = 0; h < OWOC.NUM_HOURS; h++)
+                {
+                    printf("hourly[%d]: %ld temp %.2f pop %.2f rain %.3f %s \"%s\" %s\n", h, OWOC.hour[h].dayTime, WEATHER_FLOAT(OWOC.hour[h].temperature), WEATHER_FLOAT(OWOC.hour[h].pop),
+                           WEATHER_FLOAT(OWOC.hour[h].rainVolume), OWOC.hour[h].main, OWOC.hour[h].summary, OWOC.hour[h].icon);
+                }
+        }
+
+    if(OWOC.minute)
+        {
+            for(int m = 0; m < OWOC.NUM_MINUTES; m++)
+                {
+                    printf("minutely[%d]: %ld %.2f\n", m, OWOC.minute[m].dayTime, WEATHER_FLOAT(OWOC.minute[m].precipitation));
+                }
+        }
+
+    for(int a = 0; OWOC.alert && a < OWOC.MAX_NUM_ALERTS; a++)
+        {
+            printf("alert[%d]: %s / %s %s - %s (%zu chars)\n", a, OWOC.alert[a].senderName, OWOC.alert[a].event,
+                   DATE_TEXT(OWOC.alert[a].startInfo, readableDateTime, OWOC.alert[a].alertStart),
+                   DATE_TEXT(OWOC.alert[a].endInfo, readableDateTime, OWOC.alert[a].alertEnd), strlen(OWOC.alert[a].summary));
+        }
+}
+
+static void printHistory(OpenWeatherOneCall &OWOC)
+{
+    if(!OWOC.history) return;
+    printf("history: %s %s temp %.2f rain %.3f %s \"%s\" %s sun %s-%s min %.2f max %.2f wind %.2f/%.0f day rain %.2f\n",
+           DATE_TEXT(HISTORY_TEXT.weekDayName, readableWeekday, OWOC.history[0].dayTime),
+           DATE_TEXT(HISTORY_TEXT.readableDateTime, readableDateTime, OWOC.history[0].dayTime), WEATHER_FLOAT(OWOC.history[0].temperature), WEATHER_FLOAT(OWOC.history[0].rainVolume),
+           HISTORY_TEXT.main, HISTORY_TEXT.summary, HISTORY_TEXT.icon,
+           DATE_TEXT(HISTORY_TEXT.readableSunrise, readableTime, OWOC.history[0].sunrise),
+           DATE_TEXT(HISTORY_TEXT.readableSunset, readableTime, OWOC.history[0].sunset), WEATHER_FLOAT(OWOC.history[0].min_temperature), WEATHER_FLOAT(OWOC.history[0].max_temperature),
+           WEATHER_FLOAT(OWOC.history[0].max_windSpeed), (float)OWOC.history[0].max_windBearing, WEATHER_FLOAT(OWOC.history[0].day_rainVolume));
+}
+
+int main(int argc, char **argv)
+{
+    // ESP32 runs on UTC unless told otherwise; the library adds the offset itself
+    setenv("TZ", "UTC0", 1);
+    tzset();
+
+    const char *payloads = OWOC_PAYLOAD_DIR;
+    int parser = DOM_PARSER;
+    bool useArena = false;
+    long keepAlive = KEEPALIVE_REFRESH;
+    int excludes = 0;
+    int dateFormat = 0;
+    bool async = false;
+    int fetchMode = SEQUENTIAL_FETCH;
+    unsigned long latency = 0;
+    bool cache = false;
+    bool snapshot = false;
+    bool useStatic = false;
+    bool series = false;
+    int days = ONECALL_DAYS, hours = ONECALL_HOURS, minutes = ONECALL_MINUTES;
+    for(int a = 1; a < argc; a++)
+        {
+            if(!strcmp(argv[a], "--stream")) parser = STREAM_PARSER;
+            else if(!strcmp(argv[a], "--arena")) useArena = true;
+            else if(!strcmp(argv[a], "--no-keepalive")) keepAlive = KEEPALIVE_OFF;
+            else if(!strcmp(argv[a], "--async")) async = true;
+            else if(!strcmp(argv[a], "--concurrent")) fetchMode = CONCURRENT_FETCH;
+            else if(!strcmp(argv[a], "--cache")) cache = true;
+            else if(!strcmp(argv[a], "--snapshot")) snapshot = true;
+            else if(!strcmp(argv[a], "--static")) useStatic = true;
+            else if(!strcmp(argv[a], "--series")) series = true;
+            else if(!strcmp(argv[a], "--latency") && (a + 1 < argc)) latency = strtoul(argv[++a], NULL, 10);
+            else if(!strcmp(argv[a], "--horizon") && (a + 1 < argc)) sscanf(argv[++a], "%d,%d,%d", &days, &hours, &minutes);
+            else if(!strcmp(argv[a], "--exclude") && (a + 1 < argc)) excludes = atoi(argv[++a]);
+            else if(!strcmp(argv[a], "--format") && (a + 1 < argc)) dateFormat = atoi(argv[++a]);
+            else payloads = argv[a];
+        }
+
+    ReplayTransport replay(payloads);
+    replay.install();
+    // A TLS handshake costs about two round trips
+    HostTransport::setLatency(latency, 2 * latency);
+
+    // Full horizons, so the output matches the heap build
+    OpenWeatherOneCall heapOWOC;
+    OpenWeatherOneCallT<ONECALL_DAYS, ONECALL_HOURS, ONECALL_MINUTES, ONECALL_ALERTS> staticOWOC;
+    OpenWeatherOneCall &OWOC = useStatic ? staticOWOC : heapOWOC;
+    int error_code;
+
+    OWOC.setOpenWeatherKey(replayKey);
+    if(!useStatic) OWOC.setParser(parser); // OpenWeatherOneCallT streams
+    if(useArena) OWOC.setArena();
+    OWOC.setKeepAlive(keepAlive);
+    OWOC.setFetchMode(fetchMode);
+    if(cache)
+        {
+            int cacheError = OWOC.setCache(600, 600); // the stale window needs SNAPSHOT_ON, not --arena or --static
+            if(cacheError) fprintf(stderr, "setCache: error %d\n", cacheError);
+        }
+    if(snapshot) OWOC.setSnapshots(SNAPSHOT_ON);
+    if(series) OWOC.setSeries(SERIES_ON);
+    if(excludes) OWOC.setExcl(excludes);
+    if(dateFormat) OWOC.setDateTimeFormat(dateFormat);
+    if(OWOC.setHorizon(days, hours, minutes)) fprintf(stderr, "horizon %d,%d,%d rejected\n", days, hours, minutes);
+    OWOC.setUnits(METRIC);
+    OWOC.setLatLon(51.685238f, 5.060593f);
+
+    unsigned long started = millis();
+    if(async)
+        {
+            // The loop a display would run while the refresh is in flight
+            unsigned long frames = 0;
+            int reported = ASYNC_RUNNING;
+            OWOC.parseWeatherAsync([&reported](int result) { reported = result; });
+            while(OWOC.isRefreshing())
+                {
+                    frames++;
+                    delay(1);
+                }
+            error_code = OWOC.getAsyncResult();
+            fprintf(stderr, "async: %lu frames, callback %d\n", frames, reported);
+        }
+    else error_code = OWOC.parseWeather();
+    if(latency) fprintf(stderr, "current refresh: %lu ms\n", millis() - started);
+    if(cache)
+        {
+            // Same parameters again: served without a request
+            int cached = OWOC.parseWeather();
+            fprintf(stderr, "cache: error %d status %d after %lu requests\n", cached, OWOC.getCacheStatus(), HostTransport::stats().requests);
+        }
+    if(series && OWOC.series)
+        {
+            fprintf(stderr, "series: %d hours, %d minutes, max temperature %.2f\n", OWOC.series->hours, OWOC.series->minutes,
+                    seriesMax(OWOC.series->temperature, OWOC.series->hours));
+        }
+    printf("== current (error %d)\n", error_code);
+    if(excludes || (days < ONECALL_DAYS) || (hours < ONECALL_HOURS) || (minutes < ONECALL_MINUTES)) printf("request: %s\n", replay.lastURL().c_str());
+    printCurrent(OWOC);
+
+    OWOC.setHistory(1);
+    error_code = OWOC.parseWeather();
+    printf("== history (error %d)\n", error_code);
+    printHistory(OWOC);
+    OWOC.setHistory(0);
+
+    error_code = OWOC.setLatLon(4504476);
+    printf("== city id (error %d) %.4f %.4f\n", error_code, OWOC.location.LATITUDE, OWOC.location.LONGITUDE);
+
+    // In the offline table, no request
+    error_code = OWOC.setLatLon(4501018);
+    printf("== offline city id (error %d) %.4f %.4f\n", error_code, OWOC.location.LATITUDE, OWOC.location.LONGITUDE);
+
+    error_code = OWOC.setLatLon();
+    printf("== ip location (error %d) %s, %s %s %.4f %.4f\n", error_code, OWOC.location.CITY, OWOC.location.STATE, OWOC.location.COUNTRY, OWOC.location.LATITUDE, OWOC.location.LONGITUDE);
+
+    if(useArena) fprintf(stderr, "arena peak %zu of %zu bytes\n", OWOC.getArenaUsed(), OWOC.getArenaSize());
+    printf("== %lu requests, %lu connections, %lu bytes replayed\n", HostTransport::stats().requests, HostTransport::stats().connections, HostTransport::stats().bytes);
+
+    if(snapshot)
+        {
+            // A body without "timezone" fails after current was cleared
+            OWOC.setLatLon(51.685238f, 5.060593f);
+            OWOC.setCache(0, 0);
+            OWOC.parseWeather();
+            OpenWeatherOneCall::weatherSnapshot view;
+            unsigned long seq = OWOC.readSnapshot(view);
+            replay.replace("/onecall", "city.json");
+            error_code = OWOC.parseWeather();
+            fprintf(stderr, "snapshot: failed refresh (error %d) %s the results, published %s\n", error_code,
+                    (OWOC.current && (OWOC.current == view.current) && (OWOC.current->temperature != 0)) ? "kept" : "lost",
+                    OWOC.snapshotChanged(seq) ? "changed" : "unchanged");
+        }
+    return 0;
+}
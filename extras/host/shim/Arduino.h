@@ -0,0 +1,124 @@
+/*
+   Arduino.h (host shim)
+   Minimal stand-in for the ESP32 Arduino core so the library can be
+   compiled and exercised on an ordinary Linux box.
+
+   Only what OpenWeatherOneCall uses is provided: Stream, String,
+   Serial, PROGMEM helpers, millis() and delay().
+*/
+
+#ifndef _OWOC_HOST_ARDUINO_H
+#define _OWOC_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include <functional>
+#include <string>
+
+using std::abs;
+
+#define PROGMEM
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#define strcpy_P(dst, src) strcpy((dst), (src))
+
+unsigned long millis(void);
+void delay(unsigned long ms);
+
+// Byte source consumed by ArduinoJson (ARDUINOJSON_ENABLE_ARDUINO_STREAM)
+class Stream
+{
+public:
+    virtual ~Stream() {}
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    size_t readBytes(char *buffer, size_t length)
+    {
+        size_t count = 0;
+        while(count < length)
+            {
+                int c = read();
+                if(c < 0) break;
+                *buffer++ = (char)c;
+                count++;
+            }
+        return count;
+    }
+};
+
+// Stream over an in-memory body, used by the replay transport
+class MemoryStream : public Stream
+{
+public:
+    void assign(const std::string &body)
+    {
+        _body = body;
+        _pos = 0;
+    }
+    int available() override
+    {
+        return (int)(_body.size() - _pos);
+    }
+    int read() override
+    {
+        return (_pos < _body.size()) ? (unsigned char)_body[_pos++] : -1;
+    }
+    int peek() override
+    {
+        return (_pos < _body.size()) ? (unsigned char)_body[_pos] : -1;
+    }
+
+private:
+    std::string _body;
+    size_t _pos = 0;
+};
+
+class String
+{
+public:
+    String() {}
+    String(const char *s) : _s(s ? s : "") {}
+    String(const std::string &s) : _s(s) {}
+    const char *c_str() const
+    {
+        return _s.c_str();
+    }
+    unsigned int length() const
+    {
+        return (unsigned int)_s.size();
+    }
+
+private:
+    std::string _s;
+};
+
+class HardwareSerial
+{
+public:
+    void begin(unsigned long) {}
+    int printf(const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        int n = vfprintf(stderr, format, args);
+        va_end(args);
+        return n;
+    }
+    void print(const char *s)
+    {
+        fputs(s, stderr);
+    }
+    void println(const char *s = "")
+    {
+        fprintf(stderr, "%s\n", s);
+    }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,102 @@
+/*
+   HTTPClient.h (host shim)
+   Same surface as the ESP32 HTTPClient calls used by the library.
+   Requests are answered by the HostTransport handler instead of the
+   network, see HostTransport.h.
+
+   Connections are counted like on the device: begin(url) opens one per
+   request, begin(client, url) reuses the client while it is connected
+   and setReuse() is on.
+*/
+
+#ifndef _OWOC_HOST_HTTPCLIENT_H
+#define _OWOC_HOST_HTTPCLIENT_H
+
+#include <Arduino.h>
+#include "HostTransport.h"
+#include "WiFiClient.h"
+
+#define HTTP_CODE_OK 200
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient
+{
+public:
+    bool begin(const char *url)
+    {
+        _client = NULL;
+        _url = url;
+        return true;
+    }
+    bool begin(WiFiClient &client, const char *url)
+    {
+        _client = &client;
+        _url = url;
+        return true;
+    }
+    bool begin(const String &url)
+    {
+        return begin(url.c_str());
+    }
+    // As on the ESP32, HTTP/1.0 turns reuse off, setReuse() after it turns it back on
+    void useHTTP10(bool usehttp10 = true)
+    {
+        _http10 = usehttp10;
+        _reuse = !usehttp10;
+    }
+    void setReuse(bool reuse)
+    {
+        _reuse = reuse;
+    }
+    int GET()
+    {
+        std::string body;
+        connect();
+        _code = HostTransport::fetch(_url, body);
+        _size = (int)body.size();
+        _stream.assign(body);
+        return _code;
+    }
+    int getSize()
+    {
+        return _size;
+    }
+    Stream &getStream()
+    {
+        return _stream;
+    }
+    String getString()
+    {
+        std::string rest;
+        int c;
+        while((c = _stream.read()) >= 0) rest += (char)c;
+        return String(rest);
+    }
+    void end()
+    {
+        _stream.assign(std::string());
+        if(_client && !_reuse) _client->stop();
+    }
+
+private:
+    void connect()
+    {
+        size_t start = _url.find("://");
+        start = (start == std::string::npos) ? 0 : start + 3;
+        std::string host = _url.substr(start, _url.find_first_of("/?", start) - start);
+
+        if(_client && _client->connected() && (_client->host() == host)) return;
+        if(_client) _client->connect(host.c_str(), _url.compare(0, 6, "https:") ? 80 : 443);
+        HostTransport::connect();
+    }
+
+    WiFiClient *_client = NULL;
+    std::string _url;
+    MemoryStream _stream;
+    bool _http10 = false;
+    bool _reuse = true;
+    int _code = 0;
+    int _size = -1;
+};
+
+#endif
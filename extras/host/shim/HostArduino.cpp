@@ -0,0 +1,23 @@
+/*
+   HostArduino.cpp
+   Globals and timing functions behind the host Arduino shims.
+*/
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+
+unsigned long millis(void)
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
@@ -0,0 +1,90 @@
+/*
+   HostRTOS.cpp
+   FreeRTOS task and semaphore calls on std::thread, see freertos/task.h
+   and freertos/semphr.h
+*/
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <system_error>
+
+struct HostSemaphore
+{
+    std::mutex lock;
+    std::condition_variable given;
+    bool available = false;
+};
+
+BaseType_t xPortGetCoreID(void)
+{
+    return 0;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameters, UBaseType_t priority, TaskHandle_t *created, BaseType_t core)
+{
+    (void)name;
+    (void)stackDepth;
+    (void)priority;
+    (void)core;
+    if(created) *created = NULL;
+
+    try
+        {
+            std::thread(task, parameters).detach();
+        }
+    catch(const std::system_error &)
+        {
+            return pdFAIL;
+        }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameters, UBaseType_t priority, TaskHandle_t *created)
+{
+    return xTaskCreatePinnedToCore(task, name, stackDepth, parameters, priority, created, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    (void)task;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return new(std::nothrow) HostSemaphore;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    std::lock_guard<std::mutex> guard(semaphore->lock);
+    if(semaphore->available) return pdFALSE;
+    semaphore->available = true;
+    semaphore->given.notify_one();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> guard(semaphore->lock);
+    if(ticks == portMAX_DELAY)
+        {
+            semaphore->given.wait(guard, [semaphore] { return semaphore->available; });
+        }
+    else if(!semaphore->given.wait_for(guard, std::chrono::milliseconds(ticks), [semaphore] { return semaphore->available; }))
+        {
+            return pdFALSE;
+        }
+    semaphore->available = false;
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    delete semaphore;
+}
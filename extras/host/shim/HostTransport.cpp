@@ -0,0 +1,136 @@
+/*
+   HostTransport.cpp
+   Request routing for the host build, see HostTransport.h
+*/
+
+#include "HostTransport.h"
+#include <Arduino.h>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+namespace HostTransport
+{
+static Handler activeHandler;
+static Stats counters;
+static std::mutex transportLock;
+static unsigned long requestLatency = 0;
+static unsigned long connectLatency = 0;
+
+void setHandler(Handler handler)
+{
+    activeHandler = handler;
+}
+
+void setLatency(unsigned long requestMs, unsigned long connectMs)
+{
+    requestLatency = requestMs;
+    connectLatency = connectMs;
+}
+
+int fetch(const std::string &url, std::string &body)
+{
+    int httpCode = 404;
+    body.clear();
+    {
+        std::lock_guard<std::mutex> guard(transportLock);
+        counters.requests++;
+        if(activeHandler)
+            {
+                httpCode = activeHandler(url, body);
+                counters.bytes += body.size();
+            }
+    }
+    if(requestLatency) delay(requestLatency);
+    return httpCode;
+}
+
+void connect(void)
+{
+    {
+        std::lock_guard<std::mutex> guard(transportLock);
+        counters.connections++;
+    }
+    if(connectLatency) delay(connectLatency);
+}
+
+Stats &stats(void)
+{
+    return counters;
+}
+
+void resetStats(void)
+{
+    counters = Stats();
+}
+}
+
+ReplayTransport::ReplayTransport(const std::string &directory) : _directory(directory)
+{
+    // Most specific first, the One Call sub-endpoints share its prefix
+    route("/onecall/timemachine", "timemachine.json");
+    route("/onecall/day_summary", "day_summary.json");
+    route("/onecall", "onecall.json");
+    route("/air_pollution", "air_pollution.json");
+    route("reverse-geocode", "reverse_geocode.json");
+    route("/weather?id=", "city.json");
+    route("ipify.org", "ipify.txt");
+    route("ipapi.co", "ipapi.json");
+}
+
+void ReplayTransport::route(const std::string &pattern, const std::string &file)
+{
+    _routes.push_back(std::make_pair(pattern, file));
+}
+
+void ReplayTransport::replace(const std::string &pattern, const std::string &file)
+{
+    for(size_t i = 0; i < _routes.size(); i++)
+        {
+            if(_routes[i].first == pattern)
+                {
+                    _routes[i].second = file;
+                    return;
+                }
+        }
+    route(pattern, file);
+}
+
+void ReplayTransport::clearRoutes(void)
+{
+    _routes.clear();
+}
+
+void ReplayTransport::install(void)
+{
+    HostTransport::setHandler([this](const std::string &url, std::string &body)
+    {
+        return serve(url, body);
+    });
+}
+
+int ReplayTransport::serve(const std::string &url, std::string &body)
+{
+    _lastURL = url;
+    for(size_t i = 0; i < _routes.size(); i++)
+        {
+            if(url.find(_routes[i].first) == std::string::npos) continue;
+            return load(_routes[i].second, body) ? 200 : 404;
+        }
+    return 404;
+}
+
+bool ReplayTransport::load(const std::string &file, std::string &body)
+{
+    std::map<std::string, std::string>::iterator cached = _bodies.find(file);
+    if(cached == _bodies.end())
+        {
+            std::ifstream in(_directory + "/" + file, std::ios::binary);
+            if(!in) return false;
+            std::ostringstream contents;
+            contents << in.rdbuf();
+            cached = _bodies.insert(std::make_pair(file, contents.str())).first;
+        }
+    body = cached->second;
+    return true;
+}
@@ -0,0 +1,73 @@
+/*
+   HostTransport.h
+   Replaces the network for the host build. Every HTTPClient::GET()
+   is routed to the installed handler which returns an HTTP status
+   and fills the response body.
+
+   Requests may come from several tasks at once; the handler is called
+   under a lock, the simulated latency is spent outside it.
+
+   ReplayTransport serves recorded response bodies from a directory,
+   matching the request URL against a list of substrings.
+*/
+
+#ifndef _OWOC_HOST_TRANSPORT_H
+#define _OWOC_HOST_TRANSPORT_H
+
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace HostTransport
+{
+typedef std::function<int(const std::string &url, std::string &body)> Handler;
+
+struct Stats
+{
+    unsigned long requests = 0;
+    unsigned long connections = 0; // opened by HTTPClient, see HTTPClient.h
+    unsigned long bytes = 0;
+};
+
+void setHandler(Handler handler);
+// Simulated round trip per request and extra handshake time per new connection
+void setLatency(unsigned long requestMs, unsigned long connectMs);
+int fetch(const std::string &url, std::string &body);
+void connect(void); // HTTPClient opened a connection
+Stats &stats(void);
+void resetStats(void);
+}
+
+class ReplayTransport
+{
+public:
+    // Directory holding the recorded bodies, default routes installed
+    explicit ReplayTransport(const std::string &directory);
+
+    // First matching pattern wins; patterns are plain substrings
+    void route(const std::string &pattern, const std::string &file);
+    // Point an existing pattern at another body, e.g. a corpus entry
+    void replace(const std::string &pattern, const std::string &file);
+    void clearRoutes(void);
+
+    // Make this the active HostTransport handler
+    void install(void);
+
+    int serve(const std::string &url, std::string &body);
+    const std::string &lastURL(void) const
+    {
+        return _lastURL;
+    }
+
+private:
+    bool load(const std::string &file, std::string &body);
+
+    std::string _directory;
+    std::vector<std::pair<std::string, std::string> > _routes;
+    std::map<std::string, std::string> _bodies; // file -> cached body
+    std::string _lastURL;
+};
+
+#endif
@@ -0,0 +1,37 @@
+/*
+   WiFi.h (host shim)
+   The host is always "connected"; tests may flip the status to
+   exercise the not-connected path of parseWeather().
+*/
+
+#ifndef _OWOC_HOST_WIFI_H
+#define _OWOC_HOST_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum
+{
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+class WiFiClass
+{
+public:
+    wl_status_t status()
+    {
+        return _status;
+    }
+    void setStatus(wl_status_t s)
+    {
+        _status = s;
+    }
+
+private:
+    wl_status_t _status = WL_CONNECTED;
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,45 @@
+/*
+   WiFiClient.h (host shim)
+   Only tracks whether a connection is open, HTTPClient counts the
+   connections it opens in HostTransport::stats().
+*/
+
+#ifndef _OWOC_HOST_WIFICLIENT_H
+#define _OWOC_HOST_WIFICLIENT_H
+
+#include <Arduino.h>
+#include <string>
+
+class WiFiClient
+{
+public:
+    virtual ~WiFiClient()
+    {
+    }
+    int connect(const char *host, uint16_t port)
+    {
+        _host = host;
+        _port = port;
+        _connected = true;
+        return 1;
+    }
+    uint8_t connected()
+    {
+        return _connected;
+    }
+    void stop()
+    {
+        _connected = false;
+    }
+    const std::string &host() const
+    {
+        return _host;
+    }
+
+private:
+    std::string _host;
+    uint16_t _port = 0;
+    bool _connected = false;
+};
+
+#endif
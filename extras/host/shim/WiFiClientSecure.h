@@ -0,0 +1,28 @@
+/*
+   WiFiClientSecure.h (host shim)
+   No TLS on the host, the certificate settings are accepted and ignored.
+*/
+
+#ifndef _OWOC_HOST_WIFICLIENTSECURE_H
+#define _OWOC_HOST_WIFICLIENTSECURE_H
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient
+{
+public:
+    void setInsecure()
+    {
+        _insecure = true;
+    }
+    void setCACert(const char *rootCA)
+    {
+        _rootCA = rootCA;
+    }
+
+private:
+    bool _insecure = false;
+    const char *_rootCA = NULL;
+};
+
+#endif
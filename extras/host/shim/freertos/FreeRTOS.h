@@ -0,0 +1,28 @@
+/*
+   freertos/FreeRTOS.h (host shim)
+   Types and constants of the few FreeRTOS calls the library makes.
+*/
+
+#ifndef _OWOC_HOST_FREERTOS_H
+#define _OWOC_HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t; // one tick is 1 ms, as configured by Arduino-ESP32
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFF
+#define portNUM_PROCESSORS 2
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+// The host has no cores to report
+BaseType_t xPortGetCoreID(void);
+
+#endif
@@ -0,0 +1,18 @@
+/*
+   freertos/semphr.h (host shim)
+   Binary semaphores on a mutex and condition variable.
+*/
+
+#ifndef _OWOC_HOST_SEMPHR_H
+#define _OWOC_HOST_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+typedef struct HostSemaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+#endif
@@ -0,0 +1,17 @@
+/*
+   freertos/task.h (host shim)
+   Tasks run on a detached std::thread. Stack size, priority and core
+   are ignored; vTaskDelete(NULL) at the end of a task function returns
+   and the thread ends with the function.
+*/
+
+#ifndef _OWOC_HOST_TASK_H
+#define _OWOC_HOST_TASK_H
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameters, UBaseType_t priority, TaskHandle_t *created);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameters, UBaseType_t priority, TaskHandle_t *created, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+
+#endif
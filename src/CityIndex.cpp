@@ -0,0 +1,156 @@
+/*
+   CityIndex.cpp
+   Block search over the packed IDs and a ring search over the grid
+   in CityTable.h, see CityIndex.h
+*/
+
+#include "CityIndex.h"
+#include <math.h>
+
+struct CityBlock
+{
+    uint32_t first;
+    uint32_t offset;
+};
+
+struct CityName
+{
+    const char *name;
+    char state[3];
+    char country[3];
+};
+
+#include "CityTable.h"
+
+#define KM_PER_DEGREE 111.2f
+#define CITY_BLOCKS ((CITY_TABLE_SIZE + CITY_BLOCK - 1) / CITY_BLOCK)
+
+static_assert(sizeof(cityBlocks) / sizeof(cityBlocks[0]) == CITY_BLOCKS, "CityTable.h: one block per CITY_BLOCK cities");
+
+// Next delta in cityIdDeltas, advances offset
+static uint32_t readDelta(uint32_t &offset)
+{
+    uint32_t delta = 0;
+    for(int shift = 0; ; shift += 7)
+        {
+            uint8_t byte = cityIdDeltas[offset++];
+            delta |= (uint32_t)(byte & 0x7F) << shift;
+            if(byte < 0x80) return delta;
+        }
+}
+
+static float readCoordinate(int index, int axis)
+{
+    const uint8_t *bytes = &cityCoords[6 * index + 3 * axis];
+    int32_t value = (int32_t)bytes[0] | ((int32_t)bytes[1] << 8) | ((int32_t)bytes[2] << 16);
+    if(value & 0x800000) value -= 0x1000000;
+    return value / (float)CITY_COORD_SCALE;
+}
+
+bool findCityCoordinates(int cityId, float &latitude, float &longitude)
+{
+    // Last block starting at or below cityId
+    int low = 0;
+    int high = CITY_BLOCKS - 1;
+    if((cityId <= 0) || ((uint32_t)cityId < cityBlocks[0].first)) return false;
+
+    while(low < high)
+        {
+            int middle = (low + high + 1) / 2;
+            if(cityBlocks[middle].first > (uint32_t)cityId) high = middle - 1;
+            else low = middle;
+        }
+
+    uint32_t code = cityBlocks[low].first;
+    uint32_t offset = cityBlocks[low].offset;
+    int index = low * CITY_BLOCK;
+    int last = (index + CITY_BLOCK < CITY_TABLE_SIZE) ? index + CITY_BLOCK - 1 : CITY_TABLE_SIZE - 1;
+
+    while((code < (uint32_t)cityId) && (index < last))
+        {
+            code += readDelta(offset);
+            index++;
+        }
+    if(code != (uint32_t)cityId) return false;
+
+    latitude = readCoordinate(index, 0);
+    longitude = readCoordinate(index, 1);
+    return true;
+}
+
+// Distances in degrees of latitude, longitude scaled at the query's latitude
+int nearestCity(float latitude, float longitude, float maxKm)
+{
+    float scale = cosf(latitude * (float)M_PI / 180.0f);
+    float maxDistance = maxKm / KM_PER_DEGREE;
+    float best = maxDistance * maxDistance;
+    int nearest = -1;
+
+    int row = (int)floorf((latitude - CITY_GRID_LAT0) / CITY_GRID_STEP);
+    int col = (int)floorf((longitude - CITY_GRID_LON0) / CITY_GRID_STEP);
+    int rings = CITY_GRID_ROWS + CITY_GRID_COLS;
+
+    for(int ring = 0; ring <= rings; ring++)
+        {
+            // Cities in this ring are at least this far
+            float reach = (ring - 1) * CITY_GRID_STEP * scale;
+            if((ring > 1) && (reach * reach > best)) break;
+
+            for(int r = row - ring; r <= row + ring; r++)
+                {
+                    if((r < 0) || (r >= CITY_GRID_ROWS)) continue;
+                    bool edge = (r == row - ring) || (r == row + ring);
+                    for(int c = col - ring; c <= col + ring; c += (edge || !ring) ? 1 : 2 * ring)
+                        {
+                            if((c < 0) || (c >= CITY_GRID_COLS)) continue;
+                            int cell = r * CITY_GRID_COLS + c;
+                            for(uint32_t e = cityGridStart[cell]; e < cityGridStart[cell + 1]; e++)
+                                {
+                                    int index = cityGridEntries[e];
+                                    float dy = readCoordinate(index, 0) - latitude;
+                                    float dx = (readCoordinate(index, 1) - longitude) * scale;
+                                    float distance = dx * dx + dy * dy;
+                                    if(distance < best)
+                                        {
+                                            best = distance;
+                                            nearest = index;
+                                        }
+                                }
+                        }
+                }
+        }
+    return nearest;
+}
+
+int cityId(int index)
+{
+    if((index < 0) || (index >= CITY_TABLE_SIZE)) return 0;
+
+    const CityBlock &block = cityBlocks[index / CITY_BLOCK];
+    uint32_t code = block.first;
+    uint32_t offset = block.offset;
+    for(int skip = index % CITY_BLOCK; skip > 0; skip--) code += readDelta(offset);
+    return code;
+}
+
+bool cityHasNames(void)
+{
+    return CITY_NAMES;
+}
+
+bool cityName(int index, const char *&name, const char *&state, const char *&country)
+{
+#if CITY_NAMES
+    if((index < 0) || (index >= CITY_TABLE_SIZE) || !cityNames[index].name[0]) return false;
+    name = cityNames[index].name;
+    state = cityNames[index].state;
+    country = cityNames[index].country;
+    return true;
+#else
+    (void)index;
+    (void)name;
+    (void)state;
+    (void)country;
+    return false;
+#endif
+}
@@ -0,0 +1,30 @@
+/*
+   CityIndex.h
+   Offline lookups over the packed city table in CityTable.h (North
+   America by default): city ID -> coordinates, so setLatLon(CITY_ID)
+   only goes to the network for IDs it doesn't know, and coordinates ->
+   nearest city through its grid. Coordinates come back at 1e-4 degree.
+
+   Names are only there when CityTable.h was generated with them, see
+   extras/cities/make_city_table.py.
+*/
+
+#ifndef _CITY_INDEX_H
+#define _CITY_INDEX_H
+
+#include <Arduino.h>
+
+#define NEAREST_CITY_KM 50 // Farther away counts as not in the table
+
+// False when the ID is not in the table
+bool findCityCoordinates(int cityId, float &latitude, float &longitude);
+
+// Table index of the nearest city within maxKm, -1 when there is none
+int nearestCity(float latitude, float longitude, float maxKm);
+int cityId(int index);
+
+// False when the table carries no names
+bool cityHasNames(void);
+bool cityName(int index, const char *&name, const char *&state, const char *&country);
+
+#endif
@@ -0,0 +1,866 @@
+// Generated by extras/cities/make_city_table.py from NAComplete.h, do not edit.
+// Only CityIndex.cpp includes this file.
+
+#define CITY_TABLE_SIZE 1991
+#define CITY_BLOCK 32
+#define CITY_COORD_SCALE 10000 // 1e-4 degree
+
+typedef uint16_t city_index_t;
+
+// First ID of every CITY_BLOCK cities and where the rest start in cityIdDeltas
+static constexpr CityBlock cityBlocks[63] PROGMEM = {
+	{3482886,0},{3514972,34},{3515722,65},{3516770,96},{3518414,131},{3521607,171},
+	{3524527,210},{3528756,248},{3533143,290},{3817771,339},{3980177,389},{3988163,437},
+	{3995847,483},{4009984,537},{4017728,587},{4093050,649},{4150394,705},{4161957,755},
+	{4174131,809},{4215243,864},{4271901,924},{4325158,984},{4378897,1044},{4474803,1105},
+	{4577347,1164},{4673258,1224},{4693426,1279},{4728357,1336},{4838174,1397},{4931972,1460},
+	{5015723,1522},{5104930,1583},{5170511,1642},{5274183,1704},{5374361,1766},{5501785,1826},
+	{5556829,1883},{5690436,1942},{5798453,2004},{5849996,2060},{5859888,2110},{5864720,2152},
+	{5870351,2197},{5876385,2245},{5880568,2288},{5893325,2335},{5908337,2391},{5922107,2446},
+	{5939598,2500},{5951878,2551},{5961910,2592},{5978801,2646},{5993349,2697},{6063790,2752},
+	{6078372,2807},{6100761,2863},{6122668,2918},{6144189,2969},{6161471,3022},{6174961,3079},
+	{6185907,3131},{7190617,3193},{7706672,3246},
+};
+
+// Difference to the previous ID, 7 bits per byte, high bit when more follow
+static constexpr uint8_t cityIdDeltas[3262] PROGMEM = {
+	43,140,2,219,240,1,13,5,5,13,5,17,113,93,25,24,8,20,84,7,14,77,62,77,
+	7,5,2,1,98,2,48,10,25,47,22,8,5,4,57,52,82,119,5,17,11,9,6,4,
+	11,10,7,30,3,31,10,9,12,9,16,46,3,93,27,4,16,29,60,76,22,2,10,35,
+	36,61,7,3,3,43,16,14,10,117,5,83,27,3,7,48,19,39,10,8,99,37,3,110,
+	67,72,17,18,1,3,49,32,122,1,39,37,22,1,42,133,1,93,140,1,10,66,63,134,
+	1,38,8,16,20,3,6,230,1,25,104,124,77,107,3,164,1,163,1,176,1,2,7,37,
+	141,1,124,6,25,62,8,129,2,103,64,185,1,178,1,239,3,67,5,20,89,65,166,1,
+	8,69,65,3,156,2,134,2,42,58,24,22,224,1,25,38,16,123,62,134,1,2,85,64,
+	3,71,1,21,51,74,116,6,172,1,18,136,1,170,1,233,2,17,248,2,164,1,168,3,
+	227,2,104,247,3,34,1,17,33,26,57,53,82,99,22,6,25,13,31,14,21,2,32,94,
+	170,2,18,20,90,2,225,1,138,1,254,5,193,2,13,52,20,81,117,3,15,85,139,1,
+	74,10,3,214,2,180,1,103,3,225,2,190,1,140,1,147,5,29,22,242,1,14,60,28,
+	79,42,195,2,24,1,14,150,242,13,251,12,150,228,1,204,66,23,39,1,226,3,204,3,
+	85,45,154,1,171,1,208,8,73,146,87,29,146,8,57,178,6,143,2,89,124,18,221,1,
+	169,5,104,143,9,2,110,173,24,172,4,210,17,249,15,234,1,195,1,25,182,222,8,215,
+	11,119,25,156,1,175,10,137,3,255,16,114,189,7,157,14,242,3,130,1,118,21,141,1,
+	1,10,5,18,17,11,4,167,2,218,6,87,167,2,59,250,3,248,2,100,69,50,145,1,
+	3,100,133,3,147,1,182,4,193,2,187,4,112,66,20,236,3,225,2,178,5,234,2,21,
+	157,1,98,141,5,6,82,82,97,85,79,57,223,9,164,2,229,1,217,5,143,3,183,3,
+	168,1,251,1,184,1,30,161,2,59,141,4,151,9,196,1,76,66,1,11,2,115,136,2,
+	250,1,4,96,163,2,98,55,148,2,113,180,1,61,162,8,11,128,1,241,14,243,2,154,
+	3,1,211,2,238,1,243,9,156,1,135,7,172,6,205,2,165,3,10,155,1,194,2,166,
+	6,245,7,136,1,130,4,145,12,223,1,192,1,190,1,252,2,129,4,92,171,2,208,5,
+	114,131,2,73,37,60,156,1,100,203,2,1,228,4,165,1,102,189,5,201,2,50,17,142,
+	1,96,243,2,157,3,176,3,136,3,36,253,2,141,5,149,2,194,1,129,9,23,224,6,
+	201,4,186,16,146,3,231,1,136,2,188,2,136,14,225,150,1,166,1,194,11,156,40,202,
+	20,219,5,132,16,215,18,253,37,151,48,169,6,131,12,175,67,222,15,200,11,174,4,141,
+	36,133,11,236,12,190,28,211,4,242,42,204,17,164,10,46,155,53,153,43,139,38,177,3,
+	131,2,174,20,70,220,47,132,8,120,243,39,228,28,66,191,1,248,1,219,2,201,2,134,
+	11,202,2,3,216,1,15,234,6,204,7,133,7,254,2,123,109,45,220,1,129,9,147,11,
+	25,205,4,133,2,151,1,92,248,1,181,4,170,7,67,153,3,220,4,12,152,1,33,220,
+	5,107,84,17,171,1,245,1,106,195,3,180,8,187,1,47,10,39,63,128,2,231,8,74,
+	232,5,211,3,186,1,137,4,225,1,147,4,35,180,7,162,2,219,2,248,1,177,3,189,
+	1,174,1,190,8,134,2,180,4,87,250,5,72,202,4,245,1,131,3,182,1,91,79,227,
+	8,66,235,3,190,6,29,183,8,52,137,3,129,5,177,9,187,3,115,229,15,9,221,17,
+	231,1,202,12,204,11,145,29,243,13,239,8,229,23,235,50,209,29,172,11,174,5,249,4,
+	160,6,161,8,155,18,245,31,236,2,218,9,235,3,188,15,239,38,233,11,226,11,220,3,
+	94,213,22,151,2,210,29,147,6,137,12,18,192,11,134,14,186,42,151,17,183,48,172,36,
+	209,2,166,2,174,5,167,8,179,10,192,5,205,2,172,3,43,128,9,213,1,206,6,222,
+	2,172,13,199,1,176,4,239,1,167,24,192,15,201,1,161,2,225,12,235,11,147,18,169,
+	19,203,3,111,204,16,223,14,230,30,203,5,231,85,206,23,158,23,132,19,211,6,253,5,
+	133,5,228,7,175,11,205,25,254,18,196,21,223,5,195,7,186,11,187,2,157,9,136,1,
+	32,182,1,201,7,233,4,194,17,132,7,188,6,226,4,250,12,206,3,132,74,191,24,92,
+	234,23,246,9,211,21,218,18,132,3,149,31,217,9,128,1,18,169,39,249,56,142,82,255,
+	8,228,41,187,45,251,2,246,3,244,43,180,11,174,8,235,3,243,33,166,37,191,2,244,
+	14,177,21,150,15,145,18,234,12,201,27,252,29,161,4,143,54,178,5,230,37,240,2,236,
+	30,247,20,169,2,202,40,221,41,154,7,173,46,131,8,239,24,231,12,135,7,231,14,245,
+	113,135,7,185,38,200,63,174,10,7,243,18,253,30,220,2,168,29,1,82,99,162,29,218,
+	41,138,11,216,134,1,195,4,239,12,194,19,191,23,171,22,225,10,156,3,243,32,87,152,
+	9,164,51,168,79,225,7,233,1,185,30,154,3,228,35,164,19,203,29,178,28,142,126,225,
+	90,145,52,158,4,223,2,68,254,8,224,19,193,7,229,25,222,4,177,3,138,8,160,1,
+	52,179,5,14,241,11,192,1,244,7,54,187,16,166,2,191,3,236,14,233,3,221,2,140,
+	8,128,5,181,13,150,12,176,7,136,4,69,248,2,190,6,66,62,203,10,23,147,2,214,
+	2,200,2,225,1,137,1,240,3,18,206,19,236,4,162,10,235,2,146,6,255,3,131,21,
+	142,11,141,1,147,4,243,5,239,5,217,37,95,31,148,19,111,226,26,166,7,58,229,18,
+	135,8,234,2,132,6,189,4,225,2,181,1,169,2,139,5,125,134,1,217,32,154,23,197,
+	2,190,1,200,7,200,10,219,23,246,3,168,7,240,3,131,34,244,30,236,2,248,4,208,
+	2,178,7,154,68,225,27,221,19,130,14,203,38,162,85,176,5,235,11,155,64,172,77,183,
+	63,154,33,204,65,134,10,194,177,1,207,3,214,13,159,132,1,182,22,229,10,161,6,130,
+	70,134,2,169,1,185,4,166,10,243,1,118,151,1,244,21,187,9,253,8,223,33,133,2,
+	249,4,224,22,175,7,165,2,195,55,183,21,238,12,209,4,170,21,236,6,224,19,183,5,
+	178,28,164,20,234,11,192,22,155,73,154,2,156,50,239,12,176,31,175,61,161,30,219,36,
+	166,2,234,4,133,29,136,1,132,10,163,26,148,21,138,9,214,13,175,11,227,20,153,1,
+	240,10,217,17,227,47,193,6,192,7,243,46,171,27,146,3,156,12,167,7,246,2,130,21,
+	214,1,150,2,216,25,156,12,145,27,188,1,227,19,177,70,198,16,153,4,175,39,189,20,
+	206,18,149,3,236,34,205,7,143,21,254,4,220,12,76,164,81,152,8,236,63,164,26,155,
+	15,140,10,10,129,30,244,2,218,2,152,16,206,14,163,9,249,20,241,15,241,8,188,4,
+	199,23,205,3,218,4,177,7,160,9,169,20,170,1,241,23,245,32,216,20,82,55,136,2,
+	149,3,136,34,133,102,209,10,173,22,148,31,166,49,254,1,158,4,196,20,236,22,129,1,
+	163,2,147,5,227,23,137,28,177,23,167,18,240,1,214,46,184,1,237,50,180,15,159,28,
+	254,88,195,9,147,13,213,25,149,30,195,83,200,6,145,13,155,16,223,16,248,5,227,22,
+	143,33,183,10,166,6,189,161,1,218,19,138,34,160,6,141,66,158,2,166,34,143,52,199,
+	27,158,5,8,143,9,186,31,189,3,187,2,248,28,150,3,131,17,205,5,154,13,201,40,
+	154,3,213,27,185,22,168,60,244,3,147,10,169,36,152,32,147,8,132,14,220,3,182,4,
+	235,27,140,18,201,51,250,58,172,26,202,6,176,33,249,15,24,134,57,188,11,145,78,198,
+	103,184,95,18,249,41,167,29,167,30,170,37,235,4,175,23,215,48,199,41,148,34,182,10,
+	237,41,94,147,10,173,29,152,20,196,28,178,30,156,20,152,10,48,232,1,239,17,193,24,
+	219,7,246,4,233,8,232,17,144,2,194,3,240,12,250,52,243,27,137,49,199,7,102,144,
+	18,2,230,2,163,6,77,130,8,149,1,208,3,2,227,4,243,3,181,1,13,16,3,236,
+	144,1,169,103,242,9,137,22,248,26,214,2,139,30,229,8,210,15,137,8,193,130,2,149,
+	93,176,8,175,39,158,37,211,64,159,6,29,186,26,191,43,237,49,223,11,226,17,53,160,
+	4,245,13,230,21,219,6,249,28,177,27,93,184,9,251,131,1,183,19,166,89,178,63,142,
+	2,179,1,159,10,209,168,1,182,3,132,2,255,4,160,125,249,4,197,12,160,7,251,5,
+	253,3,205,2,140,7,167,23,134,1,143,4,214,10,242,20,153,17,166,1,251,7,250,6,
+	142,25,244,7,148,16,172,5,236,10,161,9,157,2,114,253,92,155,114,148,9,195,2,161,
+	4,137,2,189,4,30,212,5,22,8,254,1,232,1,99,154,6,184,10,102,63,189,1,142,
+	6,177,5,223,1,242,6,195,10,250,1,130,7,144,4,136,2,84,240,2,196,1,93,166,
+	9,134,1,113,138,2,213,2,137,1,27,5,49,165,1,91,49,41,219,1,12,8,33,211,
+	2,136,2,17,120,34,1,197,2,52,114,15,221,1,70,80,95,101,67,50,11,3,18,197,
+	3,219,1,137,1,209,1,138,1,136,6,167,2,52,115,119,182,7,32,233,2,8,84,147,
+	1,6,22,244,1,9,52,91,253,2,6,128,1,238,7,190,1,214,1,33,243,1,230,4,
+	94,14,156,1,17,52,82,177,1,1,160,1,14,90,219,1,127,3,210,2,18,184,1,140,
+	2,106,74,154,1,101,93,155,3,193,1,172,2,65,184,4,113,173,3,229,1,244,1,35,
+	150,1,182,2,15,224,4,173,1,237,1,59,98,214,3,32,200,1,25,61,216,1,6,138,
+	1,10,20,78,249,2,84,134,2,194,1,132,2,164,1,110,74,101,35,46,42,10,3,233,
+	1,120,142,1,156,1,53,40,5,88,201,11,171,6,41,108,85,198,1,12,122,131,3,81,
+	221,1,136,2,198,16,145,1,64,137,5,197,1,180,3,146,2,22,64,60,47,178,1,185,
+	3,144,21,54,39,144,8,199,6,7,128,1,131,6,168,10,188,1,158,3,201,2,160,4,
+	247,2,82,212,2,58,140,2,80,207,5,140,10,252,1,116,24,141,2,146,1,144,1,172,
+	3,181,8,188,8,240,2,211,9,212,3,163,1,166,1,136,1,132,6,218,4,238,7,252,
+	6,152,3,161,1,24,208,10,194,4,150,5,132,1,28,92,109,177,3,146,3,236,4,129,
+	1,131,3,160,1,213,2,212,11,251,1,198,5,211,1,154,4,75,43,132,4,49,4,155,
+	4,200,1,54,146,5,4,185,3,216,2,183,1,187,12,117,163,11,19,192,1,163,1,146,
+	2,177,21,219,14,170,1,184,10,44,169,4,200,2,171,6,87,181,11,154,3,131,6,155,
+	2,213,1,84,65,188,5,148,2,42,226,6,64,169,1,227,5,169,1,153,9,152,21,243,
+	1,130,5,234,1,16,42,225,1,33,33,72,190,5,146,1,65,245,3,32,143,5,104,139,
+	2,223,1,156,3,179,3,185,2,248,15,213,6,159,1,90,204,3,47,47,2,6,3,4,
+	19,4,25,3,1,50,225,6,210,2,78,129,21,245,4,131,7,44,14,15,80,89,114,18,
+	70,73,133,3,78,145,1,225,1,61,194,1,216,5,214,2,238,16,144,6,82,94,130,1,
+	154,12,194,3,179,2,135,4,251,8,144,7,14,132,3,194,17,143,3,69,145,6,198,3,
+	229,3,181,3,131,6,207,2,209,1,136,30,237,1,3,144,1,30,44,69,209,3,232,3,
+	202,1,226,7,49,179,2,156,15,142,4,248,3,2,13,83,220,3,242,1,221,5,154,2,
+	165,8,201,2,76,54,197,2,25,213,7,9,178,1,244,193,1,196,79,246,48,70,184,82,
+	180,11,142,2,118,223,1,11,243,2,241,3,164,1,162,3,57,76,128,1,21,139,7,203,
+	13,48,245,10,143,33,139,10,216,17,233,1,164,4,230,1,250,2,147,4,216,3,135,1,
+	154,1,102,177,2,230,14,150,3,216,1,33,131,17,89,237,4,191,1,153,7,65,48,178,
+	2,143,4,200,1,179,1,225,2,181,13,230,2,197,6,133,1,43,77,169,2,171,4,136,
+	2,16,154,6,250,16,214,17,211,1,150,12,112,127,154,4,146,6,220,1,26,165,4,173,
+	3,145,1,154,5,136,9,250,1,214,1,200,1,239,2,168,2,254,9,104,136,12,7,227,
+	8,251,5,242,15,184,9,198,26,173,1,190,7,64,153,6,206,12,164,11,68,138,6,228,
+	12,14,184,1,28,108,132,3,230,8,165,2,231,2,156,2,214,1,204,1,5,248,4,214,
+	1,168,6,218,7,223,3,235,11,202,15,99,145,2,39,229,27,168,7,61,221,5,198,1,
+	188,5,132,60,211,3,9,154,3,98,43,147,2,22,230,2,102,209,1,128,1,107,221,2,
+	240,1,52,212,1,239,8,23,23,197,1,207,1,247,5,146,13,123,136,13,217,10,85,154,
+	5,246,9,238,4,156,2,191,3,134,5,251,1,237,2,131,2,167,12,231,14,88,11,157,
+	2,142,1,1,182,1,181,1,30,60,232,6,152,13,216,1,166,12,43,37,238,1,204,2,
+	213,1,35,238,2,211,4,69,151,1,243,9,188,4,175,8,184,2,159,5,137,5,152,7,
+	179,1,140,2,128,2,215,2,163,2,25,144,4,215,1,135,5,69,181,2,141,7,134,7,
+	168,4,142,2,58,187,2,15,125,210,5,105,130,2,113,77,130,4,24,78,238,3,228,6,
+	218,10,134,1,171,3,138,1,5,122,150,5,167,5,236,3,133,1,145,7,176,1,136,4,
+	227,2,216,2,123,161,1,141,2,178,3,172,132,4,178,190,4,132,53,136,3,192,173,1,
+	50,148,158,4,142,146,13,197,147,3,3,201,38,130,130,15,149,2,135,1,138,1,251,5,
+	11,113,1,1,1,108,252,16,182,25,191,45,232,3,223,13,248,227,9,23,141,1,211,176,
+	4,173,4,231,8,250,168,2,231,17,182,43,154,173,1,2,35,159,1,182,3,94,179,4,
+	155,8,142,1,11,34,7,5,2,35,1,1,7,98,13,27,133,138,1,134,142,2,139,190,
+	17,148,4,149,221,2,169,12,159,189,1,192,179,8,222,184,2,200,1,188,211,17,
+};
+
+// Latitude, longitude of city i at [6 * i], little-endian int24
+static constexpr uint8_t cityCoords[CITY_TABLE_SIZE * 6] PROGMEM = {
+	53,112,3,4,6,241,237,123,3,243,250,240,180,202,3,4,6,241,43,217,2,151,51,241,
+	205,176,2,143,225,240,76,142,2,232,218,241,140,42,3,36,215,240,196,247,2,185,73,241,
+	97,63,3,241,22,241,129,147,2,211,41,241,177,8,3,39,28,241,185,221,2,140,25,241,
+	196,122,2,11,241,241,147,225,2,49,226,240,173,223,2,192,58,241,45,161,2,59,233,241,
+	120,218,2,87,20,241,153,143,2,28,2,241,223,187,2,243,250,240,212,30,3,216,173,242,
+	212,161,2,213,241,240,121,190,2,113,210,241,29,122,2,19,198,241,137,98,3,99,18,241,
+	131,119,2,108,197,241,103,82,2,119,223,241,0,238,2,203,84,241,172,126,2,196,224,241,
+	73,73,2,124,236,241,141,14,3,67,65,241,155,234,3,99,18,241,139,76,2,255,242,241,
+	107,123,2,213,235,241,204,79,2,249,229,241,252,71,2,189,239,241,61,200,2,232,93,241,
+	92,50,3,80,35,241,112,130,3,209,200,240,203,107,2,91,186,241,112,136,2,143,219,241,
+	76,11,3,17,232,240,60,228,2,73,50,241,149,227,2,119,229,240,45,30,3,57,11,241,
+	100,7,3,15,32,241,233,213,2,0,221,240,221,215,2,77,222,240,140,173,2,100,246,240,
+	84,224,2,200,15,241,244,239,2,133,40,241,197,250,2,39,220,240,48,230,2,119,229,240,
+	69,26,3,69,9,241,7,223,2,148,238,240,28,150,2,31,71,241,24,234,2,169,34,241,
+	189,6,3,119,229,240,80,52,3,208,91,242,39,45,3,65,87,242,1,210,2,101,218,240,
+	108,220,2,65,224,240,16,21,3,101,218,240,104,179,2,9,19,241,145,186,2,135,137,241,
+	82,235,2,33,209,240,40,17,3,77,222,240,137,229,2,232,224,240,141,9,3,97,215,240,
+	93,22,3,143,225,240,64,13,3,9,19,241,144,214,2,172,234,240,241,170,2,99,12,242,
+	236,26,3,105,3,241,235,54,3,51,26,241,204,204,2,156,195,240,67,213,2,237,237,240,
+	32,60,3,5,97,242,180,208,2,247,35,241,69,157,2,120,195,241,8,195,2,40,0,241,
+	49,202,2,209,194,241,8,70,2,47,235,241,252,65,3,195,2,241,24,103,3,188,17,241,
+	141,145,2,91,192,240,108,89,3,203,215,240,128,169,3,148,238,240,128,175,2,89,214,241,
+	32,191,2,53,220,241,92,56,2,201,237,241,184,124,2,249,229,241,176,36,3,201,106,242,
+	119,121,2,124,236,241,224,159,2,131,221,241,108,95,2,225,233,241,245,80,3,189,245,240,
+	249,127,2,115,57,241,223,131,2,141,154,241,29,122,2,211,41,241,95,125,2,57,11,241,
+	177,139,2,59,108,241,21,165,2,57,11,241,17,124,2,9,19,241,72,101,2,52,248,241,
+	187,193,2,55,192,241,247,177,3,165,249,240,251,218,3,31,202,240,101,110,2,101,87,241,
+	205,252,2,244,204,240,17,124,2,123,14,241,228,106,2,61,77,241,106,12,3,248,226,240,
+	103,207,2,57,11,241,95,125,2,245,63,241,117,149,2,196,224,241,29,122,2,56,39,241,
+	105,20,3,40,0,241,92,181,2,128,27,241,184,249,2,65,224,240,149,102,2,197,71,241,
+	17,124,2,239,78,241,29,122,2,52,123,241,65,116,2,161,202,241,145,0,3,55,228,240,
+	95,125,2,108,72,241,180,122,2,237,35,241,131,119,2,245,63,241,208,120,2,16,129,241,
+	136,1,3,83,235,240,233,246,2,32,206,240,22,158,2,238,48,241,169,182,2,161,77,241,
+	51,174,2,52,254,240,44,189,2,215,82,241,124,3,3,107,231,240,65,116,2,8,47,241,
+	127,203,2,68,37,241,195,19,3,203,215,240,29,122,2,188,142,241,248,155,2,1,62,241,
+	95,125,2,96,74,241,41,239,3,27,30,241,13,77,3,233,196,240,168,210,2,193,30,241,
+	109,192,2,245,63,241,220,243,2,0,221,240,16,152,2,1,62,241,131,119,2,64,121,241,
+	192,75,3,253,139,242,132,85,3,197,202,240,87,168,2,89,220,240,8,63,2,201,229,241,
+	36,107,2,85,48,241,251,99,2,31,71,241,4,23,3,0,221,240,20,34,3,253,32,241,
+	157,184,2,41,97,241,194,37,3,113,182,242,152,40,3,183,123,242,82,101,2,52,198,241,
+	152,171,2,149,210,240,33,163,2,172,228,241,77,114,2,85,173,241,228,200,2,255,242,241,
+	81,24,3,4,6,241,52,146,2,249,229,241,240,198,2,179,88,241,121,59,3,201,243,240,
+	243,136,3,212,13,241,75,49,4,164,208,240,237,129,2,40,125,241,48,105,2,244,216,241,
+	35,135,2,9,144,241,225,248,2,116,219,240,56,56,3,95,96,242,67,88,2,35,237,241,
+	96,216,3,233,196,240,183,219,2,216,15,241,217,43,3,225,239,240,101,104,3,21,17,241,
+	203,101,3,176,19,241,147,152,3,55,198,240,141,8,4,244,222,240,229,41,3,188,17,241,
+	164,169,2,239,209,240,187,68,2,172,228,241,221,90,2,24,211,241,5,120,3,40,0,241,
+	227,128,2,68,105,241,232,235,3,185,204,240,116,46,3,225,239,240,207,142,3,41,228,240,
+	143,117,2,76,244,241,133,188,2,223,164,241,188,196,3,192,207,240,247,57,2,176,238,241,
+	32,66,2,112,238,241,65,116,2,131,221,241,97,194,2,11,241,241,216,251,2,255,204,240,
+	11,139,2,204,181,241,160,253,2,139,53,241,253,168,2,195,127,241,183,146,3,215,213,240,
+	136,132,2,213,110,241,154,135,2,18,125,241,87,61,3,18,196,242,204,79,2,5,228,241,
+	247,183,2,149,210,240,84,231,2,85,218,240,68,185,2,55,192,241,216,71,3,196,230,240,
+	133,57,3,153,251,240,151,74,2,237,231,241,67,196,2,39,57,241,157,53,3,207,0,241,
+	15,204,3,131,202,240,200,32,3,208,228,240,63,166,3,191,217,240,100,132,3,244,222,240,
+	251,218,3,31,202,240,121,65,2,189,239,241,84,99,2,11,241,241,245,86,2,131,221,241,
+	5,120,3,29,230,240,67,82,3,165,249,240,20,62,3,124,105,242,113,233,2,117,1,241,
+	88,140,2,208,228,240,59,131,2,153,251,240,165,141,2,155,223,240,204,73,3,95,233,240,
+	100,138,2,119,229,240,81,155,2,96,199,241,200,157,3,196,230,240,196,122,2,11,241,241,
+	30,32,3,179,156,242,21,159,3,155,223,240,76,5,4,232,224,240,5,120,3,196,230,240,
+	227,103,2,213,235,241,111,164,2,161,202,241,17,124,2,247,160,241,184,124,2,247,160,241,
+	96,91,3,197,202,240,100,1,4,83,235,240,73,73,2,189,239,241,245,211,2,100,246,240,
+	154,226,2,215,250,240,57,159,2,47,241,240,191,109,2,65,218,241,48,99,3,21,17,241,
+	188,165,2,244,216,241,85,71,2,249,229,241,93,236,2,175,209,240,47,127,3,69,9,241,
+	178,217,2,197,216,240,1,85,2,232,218,241,1,241,2,132,198,240,156,87,2,220,220,241,
+	27,172,3,141,253,240,43,28,3,152,16,241,68,153,2,193,62,241,68,230,3,24,193,240,
+	68,117,2,215,44,241,57,117,2,135,23,241,157,110,2,245,45,241,255,108,2,117,46,241,
+	166,178,2,183,28,241,123,167,2,141,129,241,90,154,2,195,63,241,41,151,2,176,62,241,
+	15,104,2,185,79,241,192,125,2,95,120,241,98,180,2,173,214,241,241,177,2,149,218,241,
+	34,18,3,169,253,240,66,15,3,105,3,241,20,237,2,155,4,241,226,242,2,201,1,241,
+	96,148,2,187,244,241,35,121,2,122,241,241,196,122,2,215,207,241,65,116,2,228,177,241,
+	29,122,2,8,172,241,205,65,2,29,231,241,250,238,2,17,232,240,154,254,2,17,232,240,
+	130,2,3,71,237,240,198,205,2,178,240,240,13,208,2,136,240,240,210,203,2,255,234,240,
+	231,144,2,59,239,240,145,55,3,108,191,242,46,198,2,191,86,241,182,4,3,132,192,240,
+	26,242,2,171,205,240,227,245,2,221,218,240,159,255,2,25,214,240,109,55,4,15,44,239,
+	149,96,3,21,148,240,77,108,3,160,111,240,65,110,3,101,93,240,107,117,3,17,107,240,
+	101,104,3,85,179,240,124,128,3,172,109,240,129,141,3,197,208,239,51,168,3,97,183,239,
+	60,222,3,123,145,240,20,181,4,37,74,238,173,92,3,27,161,240,172,121,3,70,89,240,
+	248,18,4,1,74,239,221,84,3,213,247,239,51,168,3,51,32,240,64,138,3,67,202,239,
+	52,9,4,65,230,239,12,105,3,31,77,240,40,11,4,211,172,240,232,110,3,225,114,240,
+	227,97,3,148,113,240,244,108,3,104,162,240,129,141,3,244,97,240,213,127,3,111,147,240,
+	0,232,3,60,92,239,4,148,3,169,46,239,241,39,3,181,38,240,128,38,4,216,66,239,
+	193,172,3,251,213,239,71,123,3,89,95,240,45,155,3,193,36,240,36,220,4,115,200,238,
+	45,155,3,44,47,240,29,241,3,35,124,239,144,208,3,200,152,239,55,84,3,196,236,239,
+	101,229,3,204,62,240,215,224,3,228,183,240,185,84,4,68,180,238,14,188,3,159,58,240,
+	125,225,3,25,64,240,220,237,3,8,178,240,99,35,3,27,161,240,5,202,3,76,237,239,
+	192,69,4,135,149,239,189,132,3,239,66,239,63,166,3,25,195,239,240,186,4,5,121,238,
+	78,106,3,50,234,239,233,82,3,49,60,240,241,33,4,219,129,240,148,124,3,95,108,240,
+	172,245,3,175,178,240,29,116,3,177,122,240,57,153,3,204,62,240,228,63,4,33,146,240,
+	144,77,4,244,228,239,185,215,3,4,12,240,253,162,3,67,71,240,125,100,3,232,99,240,
+	15,174,3,81,13,240,192,194,4,93,17,239,188,28,4,40,131,240,4,186,3,184,163,239,
+	92,44,4,211,53,239,244,102,4,183,16,239,32,54,4,39,40,239,56,175,4,191,229,238,
+	48,93,4,159,20,239,24,97,4,145,169,240,132,210,3,248,144,239,89,200,3,15,32,240,
+	85,190,3,123,20,240,204,67,4,57,142,240,164,163,3,99,24,240,128,169,3,233,71,240,
+	173,217,3,75,28,240,7,217,3,152,29,240,120,199,3,48,145,239,152,34,4,67,77,239,
+	148,118,4,9,156,239,225,125,3,137,87,240,172,120,3,111,147,240,113,227,3,129,136,239,
+	171,247,3,13,169,240,245,180,3,249,54,240,209,80,4,143,231,239,61,194,3,52,129,240,
+	212,155,3,92,164,240,37,232,2,12,21,240,119,115,3,173,81,240,160,116,4,177,128,239,
+	68,108,3,234,101,240,212,155,3,216,66,239,225,119,4,152,154,240,88,253,4,59,126,238,
+	219,140,3,139,65,239,209,211,3,76,131,239,3,176,3,104,43,239,33,157,3,193,161,240,
+	87,31,4,145,169,240,17,112,4,195,14,239,63,166,3,56,176,239,121,184,3,108,209,239,
+	220,180,3,40,57,240,208,114,3,181,38,240,177,133,3,239,84,240,136,251,3,157,173,239,
+	17,187,3,183,28,240,119,115,3,32,174,240,188,159,3,39,34,240,149,221,3,104,162,240,
+	105,145,3,119,235,239,124,179,3,44,165,239,175,189,3,231,2,240,9,161,3,192,195,239,
+	3,182,3,61,158,239,165,135,3,79,200,239,28,144,3,240,62,239,133,170,3,242,176,239,
+	201,129,3,61,64,239,80,171,4,28,14,239,209,218,3,199,241,238,123,156,3,151,182,240,
+	252,59,4,147,147,239,157,185,3,100,184,239,55,178,3,3,165,239,61,194,3,105,134,240,
+	36,226,3,148,119,239,72,95,3,37,62,240,44,177,4,192,76,238,217,37,4,61,64,239,
+	1,210,3,28,246,238,187,56,4,237,243,239,72,89,4,96,211,239,165,135,3,33,146,240,
+	81,149,3,15,38,240,245,74,4,69,21,239,224,153,3,161,83,240,175,189,3,231,2,240,
+	252,184,4,104,43,239,68,48,4,56,51,239,8,195,3,45,151,239,117,143,3,163,61,239,
+	4,142,4,111,153,239,28,138,4,219,135,239,153,137,3,191,92,240,224,147,4,169,46,239,
+	77,102,4,155,235,238,216,190,4,231,133,239,161,219,3,25,189,240,15,197,2,221,170,240,
+	209,86,3,232,99,240,142,201,3,109,32,240,181,199,3,57,154,239,79,80,3,196,98,240,
+	217,68,4,125,152,238,31,25,3,128,127,240,69,39,3,102,130,240,167,51,3,198,131,240,
+	107,29,3,224,111,240,195,5,3,126,149,240,180,174,2,20,133,240,250,107,4,195,64,241,
+	205,151,4,25,52,241,32,13,4,1,130,243,96,38,5,124,230,242,62,221,4,31,246,242,
+	6,16,5,232,200,242,181,65,5,23,233,242,206,192,4,180,179,242,245,58,5,50,153,242,
+	73,83,5,210,160,242,97,79,5,55,186,242,161,241,4,202,231,242,213,61,5,248,157,242,
+	163,68,5,173,189,242,130,169,4,193,157,242,96,80,5,13,174,242,87,39,5,52,206,242,
+	10,225,4,131,215,242,201,20,5,5,166,242,81,40,5,216,173,242,112,77,5,180,226,241,
+	232,99,5,88,156,241,21,50,5,172,200,241,150,29,5,72,12,242,239,97,5,36,50,242,
+	163,69,5,238,232,241,161,110,5,127,21,242,63,43,5,126,171,241,236,140,5,171,163,241,
+	197,104,5,58,205,241,79,125,5,183,155,241,178,72,5,114,224,241,133,73,5,141,219,241,
+	248,96,5,169,0,242,167,71,5,200,237,241,22,135,5,127,219,241,189,16,6,204,122,244,
+	112,51,4,58,96,243,42,137,4,88,8,243,41,115,4,106,143,243,94,46,4,202,102,243,
+	77,47,4,208,101,243,249,110,4,113,122,243,38,12,4,104,200,243,128,253,3,33,184,243,
+	136,252,3,114,195,243,199,35,4,23,168,243,255,17,4,88,135,243,180,71,4,159,105,243,
+	117,82,4,29,143,243,22,21,4,135,166,243,192,154,4,24,32,243,14,20,4,52,198,243,
+	171,249,3,97,197,243,177,115,4,156,164,243,63,104,4,225,151,243,237,104,4,163,153,243,
+	250,241,3,117,195,243,91,53,4,229,187,243,17,99,4,87,105,243,146,43,4,0,107,243,
+	48,14,4,160,134,243,17,57,4,4,187,243,210,109,4,8,165,243,94,90,4,129,143,243,
+	133,40,4,197,104,243,29,141,4,144,101,243,186,155,4,51,239,242,70,100,4,217,100,243,
+	225,64,4,160,91,243,193,31,4,8,184,243,155,205,3,122,178,243,86,223,3,35,193,243,
+	254,25,4,234,200,243,25,235,3,155,190,243,241,211,3,135,185,243,53,191,3,94,133,243,
+	167,81,4,169,147,243,192,246,3,217,195,243,227,22,4,104,200,243,14,16,4,136,139,243,
+	100,2,4,151,199,243,167,75,4,217,106,243,70,94,4,193,149,243,197,27,4,32,111,243,
+	65,50,4,125,113,243,190,160,4,4,129,243,98,197,3,105,160,243,87,92,4,77,129,243,
+	201,220,3,99,166,243,43,24,4,77,160,243,206,228,3,124,186,243,243,36,4,121,129,243,
+	3,245,3,166,196,243,130,163,4,22,5,243,244,236,3,31,189,243,7,17,4,110,185,243,
+	205,72,4,11,95,243,153,15,4,67,120,243,162,207,3,109,181,243,194,29,4,86,121,243,
+	219,65,4,163,110,243,245,62,4,126,92,243,59,233,3,151,188,243,233,21,4,187,200,243,
+	95,45,4,27,185,243,5,59,4,236,95,243,6,101,4,69,153,243,161,76,4,244,179,243,
+	124,42,4,85,103,243,228,112,4,18,124,243,195,32,4,77,108,243,97,88,4,89,104,243,
+	167,191,3,24,135,243,224,242,3,24,198,243,137,86,4,173,149,243,142,87,4,133,146,243,
+	3,209,3,225,182,243,177,254,3,192,196,243,14,106,4,240,137,243,56,240,3,49,191,243,
+	86,174,4,136,178,242,82,172,4,30,218,242,133,58,4,50,113,243,253,70,4,76,124,243,
+	79,98,4,116,140,243,18,51,5,67,35,243,46,183,4,69,24,243,232,57,5,141,13,243,
+	86,217,4,67,111,243,90,82,5,98,48,243,177,201,4,67,10,243,38,182,4,227,38,243,
+	249,195,4,135,38,243,22,230,4,74,83,243,141,30,5,24,115,243,195,22,5,106,16,243,
+	177,24,5,223,27,243,81,180,4,126,124,243,45,46,5,205,44,243,150,243,4,19,89,243,
+	5,11,5,105,19,243,247,193,4,253,54,243,249,232,4,166,101,243,143,245,4,230,12,243,
+	237,191,4,210,40,243,119,35,5,67,42,243,135,31,5,230,50,243,117,34,5,26,46,243,
+	187,240,4,188,101,243,213,19,5,189,86,243,230,66,5,27,250,242,120,252,4,174,25,243,
+	2,226,4,247,169,243,31,219,5,78,144,242,211,14,6,161,102,242,227,224,5,58,102,242,
+	209,227,5,207,91,242,236,8,6,98,137,242,20,221,5,191,71,242,137,25,6,186,160,242,
+	73,250,5,225,81,242,36,214,5,35,78,242,32,217,5,45,73,242,197,15,6,221,71,242,
+	225,10,6,120,36,242,220,225,5,160,71,242,40,255,5,2,255,242,194,17,6,76,226,242,
+	145,239,5,27,204,242,82,248,5,94,186,242,48,212,5,252,117,241,166,234,5,200,121,241,
+	132,198,5,234,134,241,173,236,5,22,134,241,184,231,5,13,4,241,168,192,5,164,193,240,
+	71,168,5,35,143,241,28,1,6,75,194,240,32,173,5,155,8,241,84,206,5,0,34,241,
+	235,223,5,82,248,240,12,218,5,98,138,241,244,221,5,33,84,241,0,220,5,226,24,241,
+	144,196,5,128,38,241,176,18,6,32,215,240,180,190,5,55,239,240,108,202,5,155,8,241,
+	106,244,5,116,194,240,68,167,5,106,107,242,92,163,5,148,226,242,4,181,5,106,190,242,
+	234,183,5,115,59,243,125,241,5,199,31,243,114,245,5,8,24,243,207,230,5,218,33,243,
+	205,186,5,144,95,243,95,246,5,72,29,243,240,182,5,28,189,242,139,197,5,188,12,243,
+	174,191,5,53,184,242,69,210,5,10,20,243,153,195,5,54,149,242,66,176,4,126,48,242,
+	16,144,4,55,53,242,10,227,4,210,240,241,115,166,4,111,64,242,121,165,4,68,190,241,
+	221,231,4,157,2,242,6,186,4,101,223,241,246,146,4,102,52,242,238,145,4,253,255,241,
+	57,134,4,7,47,242,179,159,4,189,199,241,144,162,4,52,78,242,102,126,4,23,80,242,
+	166,244,4,211,255,241,214,149,4,227,46,242,196,152,4,194,252,241,101,2,5,223,249,241,
+	131,246,4,226,177,241,125,248,4,254,227,241,160,158,4,236,76,242,2,237,4,255,174,241,
+	134,123,4,43,35,242,93,170,4,36,31,242,22,223,4,68,221,241,113,243,5,45,79,244,
+	207,13,6,177,100,244,149,237,5,133,73,244,122,242,5,4,58,244,17,4,6,111,106,244,
+	131,240,5,60,74,244,77,249,5,99,56,244,85,207,5,32,120,244,218,11,6,79,38,244,
+	75,211,5,249,126,244,43,0,6,118,50,244,249,7,6,42,90,244,24,216,5,118,195,241,
+	212,12,6,43,138,241,4,5,6,255,186,241,196,229,5,203,153,241,178,152,5,64,173,241,
+	146,199,5,75,167,241,175,233,5,238,175,241,120,200,5,193,252,241,221,142,5,29,80,242,
+	92,165,5,0,204,241,179,232,5,95,54,242,75,41,5,67,125,242,172,156,4,139,88,242,
+	241,55,5,19,46,242,135,164,4,179,111,242,185,238,4,130,58,242,255,11,5,15,74,242,
+	183,199,4,25,96,242,145,161,4,120,101,242,4,184,4,116,123,242,80,255,4,32,78,242,
+	129,75,5,154,53,242,103,168,4,229,80,242,189,242,4,53,63,242,213,62,5,223,119,242,
+	117,78,5,79,110,242,221,100,5,47,195,243,49,88,5,1,71,244,149,113,5,90,207,243,
+	251,101,5,34,149,243,155,74,5,28,66,244,46,90,5,156,65,244,5,136,5,207,38,244,
+	231,103,5,224,116,243,201,146,5,31,169,243,173,109,5,171,155,243,1,96,5,39,190,243,
+	108,119,5,117,54,244,191,105,5,184,104,243,204,145,5,136,178,243,49,87,5,134,181,243,
+	241,56,5,73,27,244,155,23,6,164,137,244,171,19,6,61,131,244,30,6,6,47,137,244,
+	153,22,6,4,104,243,141,24,6,213,126,243,161,235,5,120,86,243,61,91,5,75,244,240,
+	222,148,5,49,130,241,1,95,5,53,39,241,152,155,5,5,135,241,116,159,5,17,45,241,
+	95,84,5,26,101,241,50,129,5,124,87,241,9,52,5,253,58,241,139,115,5,204,12,241,
+	173,108,5,77,35,241,61,85,5,27,99,241,41,130,5,229,93,241,190,107,5,60,240,240,
+	225,18,5,35,171,243,121,76,5,62,137,243,86,0,5,179,205,243,250,12,5,9,188,243,
+	54,45,5,110,191,243,151,70,5,196,167,243,198,21,5,41,133,243,7,94,5,123,117,243,
+	57,44,5,58,152,243,217,59,5,219,139,243,247,54,5,240,123,243,91,81,5,41,107,243,
+	36,48,5,239,163,243,137,114,5,181,48,243,13,93,5,230,12,243,59,127,5,48,194,242,
+	189,147,5,244,243,242,169,111,5,139,197,242,29,132,5,7,194,242,53,128,5,207,91,242,
+	83,123,5,175,190,242,100,121,5,246,91,242,17,134,5,94,204,242,60,131,5,253,107,242,
+	1,137,5,26,225,242,128,116,5,217,214,242,132,118,5,6,189,242,127,117,5,237,112,242,
+	23,133,5,60,95,243,249,137,5,242,113,242,77,124,5,118,245,242,88,212,4,57,126,241,
+	171,73,4,148,51,241,175,205,4,91,41,241,231,106,4,174,204,240,143,121,4,119,131,241,
+	104,85,4,181,21,241,230,188,4,179,32,241,116,207,4,100,45,241,190,153,4,152,157,241,
+	127,127,4,121,145,241,26,222,4,137,25,241,202,243,3,129,31,241,220,198,4,27,41,241,
+	0,143,4,159,1,241,65,7,5,57,55,241,27,139,4,83,131,241,97,4,4,211,252,240,
+	96,213,4,231,218,240,66,219,4,39,212,240,246,61,4,116,35,241,135,250,4,50,72,241,
+	241,52,4,213,209,240,118,251,4,133,54,241,105,3,4,127,5,241,92,211,4,110,106,241,
+	173,239,4,189,58,241,238,248,3,53,26,241,142,39,4,62,6,241,252,144,4,85,158,241,
+	49,6,5,255,54,241,8,114,4,199,5,241,93,61,4,176,31,241,78,130,4,116,98,241,
+	244,187,4,12,71,241,126,129,4,54,121,241,131,33,5,187,45,241,150,120,4,247,136,241,
+	82,214,4,124,42,241,39,95,4,0,34,241,104,128,4,67,33,241,126,247,4,203,153,241,
+	210,233,4,128,96,241,69,132,4,216,248,240,237,14,5,68,106,241,201,197,4,154,145,241,
+	230,150,4,109,219,240,113,249,4,69,78,241,111,83,4,229,224,240,193,250,3,5,41,241,
+	54,135,4,14,9,241,36,10,5,10,73,241,110,208,4,219,67,241,4,190,4,225,34,241,
+	212,203,4,39,174,241,34,179,4,225,52,241,98,210,4,97,143,241,246,227,4,195,71,241,
+	129,255,3,122,21,241,69,133,4,124,100,241,118,209,4,94,253,240,115,0,4,84,21,241,
+	111,10,4,89,20,241,118,140,4,86,15,241,118,6,4,213,235,240,41,5,5,93,74,241,
+	115,7,4,49,228,240,146,122,4,22,111,241,23,8,5,3,77,241,0,125,4,16,4,241,
+	91,42,5,14,58,241,147,125,4,71,44,241,37,25,4,232,218,240,168,117,4,46,242,240,
+	72,131,4,26,127,241,171,25,5,67,166,241,184,196,4,6,219,240,166,200,4,241,155,241,
+	53,3,5,189,58,241,220,234,4,65,120,241,70,173,4,125,27,241,40,178,4,229,151,241,
+	17,27,4,54,218,240,77,169,5,102,159,243,201,189,5,114,47,244,11,180,5,110,44,244,
+	9,178,5,169,234,243,45,171,5,16,107,243,244,181,5,106,52,244,123,166,5,196,89,244,
+	10,177,5,80,73,244,113,161,5,191,121,243,91,205,5,246,24,244,217,184,5,171,198,243,
+	161,154,5,23,20,244,218,226,5,127,5,244,118,201,5,177,69,244,171,193,5,236,177,243,
+	207,187,5,252,128,243,17,3,6,6,244,243,157,194,5,46,154,243,65,251,5,92,144,243,
+	223,95,6,33,239,244,239,91,6,178,206,244,163,104,6,163,187,241,51,123,6,194,243,241,
+	228,51,6,109,10,242,186,58,6,51,23,242,196,98,6,74,134,242,220,94,6,38,154,242,
+	108,77,6,215,60,242,56,38,6,254,65,242,60,79,6,131,62,242,232,93,6,85,153,242,
+	0,89,6,235,148,242,166,103,6,55,146,242,76,118,6,53,61,242,18,86,6,79,143,242,
+	172,102,6,146,129,242,35,43,6,255,76,242,253,89,6,136,157,242,252,47,6,71,14,242,
+	187,101,6,233,152,242,36,83,6,48,48,242,138,66,6,173,157,242,122,27,6,162,143,242,
+	120,69,6,47,76,242,160,105,6,136,139,242,41,41,6,130,255,242,6,88,6,59,176,242,
+	151,64,6,230,254,242,99,73,6,33,236,242,20,45,6,96,244,242,117,70,6,107,13,243,
+	71,119,6,112,38,245,23,127,6,75,45,245,255,130,6,180,23,245,143,107,6,64,47,245,
+	231,134,6,236,46,245,59,121,6,250,39,245,83,117,6,116,234,244,131,109,6,57,230,244,
+	209,96,6,212,56,245,229,176,6,160,68,245,6,215,6,170,132,245,206,9,7,253,165,245,
+	16,253,6,253,108,245,180,185,6,252,111,245,16,128,6,213,229,242,196,223,6,122,2,243,
+	73,35,7,102,127,242,100,239,6,50,27,243,152,16,7,222,27,243,116,154,6,158,100,243,
+	50,164,6,244,41,243,185,100,6,80,23,243,20,169,6,140,13,243,232,217,6,34,231,242,
+	248,131,6,197,87,243,104,155,6,106,219,242,40,124,6,7,242,242,188,141,6,154,224,242,
+	222,177,6,196,243,242,21,129,6,129,84,243,112,23,7,185,70,242,82,34,7,160,84,242,
+	76,162,6,219,49,243,198,224,6,180,160,241,141,234,6,203,146,241,56,79,7,113,251,241,
+	116,66,7,182,99,241,16,39,7,98,67,241,64,73,7,81,55,242,204,222,6,141,179,241,
+	123,106,7,34,191,241,31,168,6,245,133,241,243,3,7,247,153,241,195,230,6,13,168,241,
+	71,41,7,146,59,241,19,213,6,119,129,241,44,78,7,103,128,241,229,47,7,48,145,241,
+	80,34,6,206,222,241,98,31,6,228,4,242,21,80,7,167,49,241,208,7,7,226,48,241,
+	232,92,6,155,8,241,180,59,6,139,225,240,162,62,6,132,254,240,52,122,6,234,237,240,
+	108,71,6,155,8,241,48,81,6,215,11,241,156,63,6,99,254,240,12,87,6,11,32,241,
+	200,140,6,233,41,245,205,180,6,85,11,245,224,181,6,205,15,245,14,47,6,232,139,244,
+	96,32,6,42,180,244,201,139,6,232,5,244,211,54,6,218,210,244,205,55,6,16,209,244,
+	196,57,6,166,228,244,125,110,6,81,73,244,234,52,6,201,185,244,113,112,6,161,143,244,
+	169,186,6,141,188,244,37,208,6,184,167,244,69,161,6,72,144,244,181,184,6,43,107,244,
+	224,136,6,246,248,243,241,174,6,114,123,244,141,149,6,129,37,244,248,132,6,10,30,244,
+	183,142,6,187,97,244,128,152,6,167,174,244,98,157,6,226,193,244,35,125,6,168,57,244,
+	217,53,6,52,189,244,153,147,6,64,187,244,138,68,6,229,186,244,162,146,6,180,114,244,
+	45,165,6,52,189,244,165,145,6,167,131,244,215,138,6,189,170,244,213,137,6,226,249,243,
+	45,82,6,14,137,243,245,90,6,198,59,243,116,28,6,163,37,243,54,80,6,118,128,243,
+	177,61,6,136,169,243,21,44,6,183,145,243,235,50,6,122,10,244,204,56,6,59,33,244,
+	83,35,6,111,91,244,31,84,6,221,115,244,247,48,6,4,122,244,50,40,6,114,207,243,
+	67,78,6,49,113,244,241,49,6,56,194,243,103,72,6,85,100,244,177,60,6,46,237,243,
+	54,39,6,158,208,243,114,29,6,130,80,244,193,99,6,242,246,243,82,76,6,26,109,244,
+	12,46,6,201,212,243,32,42,6,40,107,244,135,67,6,2,249,243,63,37,6,125,67,244,
+	227,227,6,63,245,240,165,236,6,23,68,241,103,158,6,66,195,240,245,215,6,170,225,244,
+	211,179,6,125,233,244,205,21,7,38,250,241,62,205,6,242,10,242,246,173,6,92,129,242,
+	253,220,6,58,229,241,231,218,6,233,12,242,173,187,6,217,157,242,81,244,6,101,227,241,
+	137,150,6,185,65,242,77,160,6,86,139,242,122,195,6,35,140,242,105,30,6,235,178,243,
+	213,60,5,97,12,239,152,28,5,113,213,238,252,53,5,149,143,238,22,9,5,219,251,238,
+	255,228,4,207,3,239,164,26,5,223,222,238,85,254,4,124,130,238,150,157,5,221,175,237,
+	213,102,5,56,197,237,22,175,5,55,186,237,248,13,5,186,95,238,88,164,5,51,100,237,
+	124,158,5,27,188,237,95,247,5,67,139,237,54,253,5,94,97,237,223,185,5,95,145,237,
+	62,49,5,9,6,238,166,151,5,173,184,237,124,203,5,216,86,237,196,23,5,224,27,238,
+	215,228,5,206,127,237,247,139,5,39,199,237,221,17,5,75,33,238,82,208,5,231,64,237,
+	53,254,5,168,111,237,217,144,5,64,198,237,9,179,5,115,94,237,128,32,5,112,11,238,
+	178,149,5,125,102,237,192,63,5,215,203,237,104,36,5,181,7,238,117,162,5,194,174,237,
+	41,47,5,25,19,238,197,64,5,85,15,238,90,209,5,249,142,237,58,170,5,23,203,237,
+	189,106,5,242,204,237,52,213,5,217,120,237,142,156,5,52,188,237,224,16,5,55,28,238,
+	247,138,5,89,212,237,38,215,5,76,14,240,32,174,5,243,148,239,17,176,5,239,137,239,
+	178,20,6,126,250,239,15,223,5,22,138,239,230,9,6,109,179,240,36,89,5,79,185,239,
+	232,98,5,217,189,239,116,160,5,131,245,239,53,4,5,41,4,240,24,92,5,161,240,239,
+	19,224,4,135,185,239,65,1,5,80,54,240,88,122,5,220,92,239,74,86,5,182,198,239,
+	148,112,5,38,178,239,155,153,5,230,189,239,212,143,5,80,54,240,192,150,5,248,75,238,
+	250,6,6,208,244,237,67,126,5,167,120,238,144,238,5,25,191,237,160,21,6,134,42,238,
+	98,204,5,44,57,238,24,2,6,251,195,237,200,235,4,253,131,240,133,204,4,109,91,240,
+	52,96,4,186,170,240,49,218,4,139,203,239,143,206,4,46,205,239,185,237,4,24,133,240,
+	99,37,5,246,81,240,220,148,4,215,70,240,224,141,5,102,158,240,100,120,5,213,157,240,
+	13,231,4,227,119,240,111,167,4,64,168,240,146,202,4,130,171,240,72,216,4,81,66,240,
+	41,172,5,157,182,238,80,252,5,249,13,239,173,27,5,83,156,240,89,215,4,172,13,239,
+	171,67,5,126,252,238,107,229,8,59,125,235,231,233,8,155,128,235,254,119,8,137,242,235,
+	174,56,7,73,91,237,249,123,8,247,233,235,61,171,8,108,182,235,4,118,8,233,226,235,
+	11,165,8,209,131,235,163,180,8,172,89,235,19,185,8,139,89,235,242,227,8,185,128,235,
+	38,229,8,218,124,235,228,157,8,9,205,235,14,159,8,170,180,235,13,22,9,232,173,234,
+	187,26,9,27,197,234,71,36,6,80,41,240,240,216,6,55,146,238,163,189,6,252,223,238,
+	2,2,7,248,71,238,154,71,7,73,52,238,212,48,7,163,37,238,76,29,7,73,52,238,
+	128,113,6,102,0,239,244,175,6,55,241,238,174,228,6,241,158,238,32,252,6,39,9,239,
+	210,91,7,22,144,238,5,96,7,16,145,238,100,108,7,48,51,239,230,46,7,126,76,239,
+	98,67,7,58,150,238,218,17,7,114,182,238,208,90,7,212,135,239,184,94,7,53,245,239,
+	240,49,7,153,46,239,12,254,6,225,246,238,80,115,7,87,172,240,236,52,7,138,81,240,
+	196,92,7,82,165,240,156,57,7,8,117,240,190,93,7,83,188,240,70,75,7,128,61,240,
+	210,97,6,195,46,240,98,74,6,199,56,240,91,33,6,47,150,240,146,65,6,60,96,238,
+	130,26,6,210,71,238,26,85,6,147,254,237,73,203,6,29,129,237,174,232,6,227,58,237,
+	45,166,6,105,13,237,79,246,6,57,116,237,202,183,6,35,39,238,108,242,6,192,62,237,
+	98,115,6,107,66,237,37,250,6,19,187,240,174,148,6,246,165,240,175,144,6,229,89,240,
+	134,193,6,137,46,240,86,75,6,12,227,238,250,42,7,115,27,237,138,61,7,14,66,237,
+	219,50,7,23,91,237,149,101,7,170,85,237,151,58,7,91,75,237,159,15,7,236,62,237,
+	59,121,7,200,85,237,145,60,7,132,165,237,181,53,7,231,86,237,46,82,7,123,90,237,
+	51,88,7,138,75,237,86,72,7,92,91,237,45,77,7,7,89,237,4,90,7,255,35,238,
+	60,119,7,209,85,237,36,37,7,183,208,237,60,45,7,197,93,237,27,86,7,86,55,237,
+	151,64,7,50,105,237,130,62,7,74,108,237,158,19,7,113,164,237,121,63,7,233,156,237,
+	102,68,7,4,78,237,101,28,7,189,156,237,149,20,7,68,166,237,254,150,6,70,149,239,
+	64,163,6,240,20,239,116,105,8,107,239,235,74,154,8,17,113,235,177,198,8,196,104,235,
+	12,119,8,229,174,235,253,233,8,229,85,235,138,230,8,131,118,235,197,233,8,199,73,235,
+	122,10,9,2,83,235,158,9,9,55,85,235,236,221,8,60,85,235,227,78,3,9,230,231,
+	6,68,3,78,238,231,80,94,3,154,176,231,144,87,3,238,170,231,97,58,3,163,9,232,
+	143,47,3,151,23,232,178,45,3,58,14,232,141,90,3,184,174,231,228,69,3,21,228,231,
+	161,88,3,52,170,231,137,48,3,210,35,232,61,78,3,20,226,231,215,74,3,9,223,231,
+	157,10,3,250,56,232,34,67,3,47,231,231,36,69,3,134,235,231,124,16,3,219,70,232,
+	77,64,3,169,233,231,27,65,3,229,228,231,20,74,3,216,233,231,157,49,3,98,23,232,
+	242,246,8,179,17,232,85,17,10,33,106,231,254,99,9,99,66,233,61,172,9,156,69,233,
+	109,1,10,161,231,233,91,42,9,73,241,230,35,237,9,180,182,233,64,227,9,91,109,233,
+	110,99,9,200,187,230,117,120,9,136,83,234,1,94,9,221,48,233,111,253,9,20,236,233,
+	154,250,8,156,206,231,38,54,9,152,233,232,52,67,10,110,21,233,121,229,9,116,114,233,
+	244,60,9,89,194,233,221,98,9,166,45,233,192,65,9,12,49,233,122,197,9,86,195,233,
+	193,187,9,35,21,233,25,27,9,201,223,232,61,2,9,65,210,231,242,246,8,58,50,232,
+	117,182,9,3,237,233,219,221,8,4,185,232,94,91,9,130,45,233,126,226,9,192,119,234,
+	12,226,8,130,252,231,181,96,9,138,53,233,69,28,10,107,97,231,66,148,9,81,229,230,
+	24,229,9,48,106,233,122,115,9,63,139,233,79,60,9,33,199,233,186,228,9,212,117,233,
+	141,228,9,153,168,233,89,246,9,16,170,233,47,40,10,61,213,233,113,29,9,7,234,232,
+	48,101,9,72,58,233,36,122,9,152,202,233,57,217,9,172,31,231,105,190,9,3,69,233,
+	201,25,9,37,224,232,143,99,9,217,167,230,111,103,9,187,35,233,90,6,10,163,34,232,
+	80,78,9,160,47,233,135,179,10,177,21,234,23,56,9,60,234,232,104,61,9,121,235,232,
+	7,56,9,198,235,232,54,56,10,124,133,231,4,243,8,16,64,231,217,102,8,193,59,231,
+	131,244,8,106,24,232,149,191,8,107,154,232,108,209,8,152,190,232,38,29,9,20,0,232,
+	55,53,10,145,48,231,108,191,9,78,194,232,150,178,8,26,228,231,69,103,9,208,69,233,
+	246,255,8,201,186,231,110,137,9,104,28,233,55,103,9,53,44,233,233,54,9,102,164,230,
+	195,26,9,149,228,232,103,132,9,186,45,234,157,17,9,133,94,232,105,67,9,3,81,231,
+	134,139,8,218,102,231,7,218,9,13,64,233,96,18,9,1,255,231,183,66,9,71,234,232,
+	147,215,9,208,194,230,141,228,9,126,3,231,87,225,9,42,132,233,26,145,10,122,206,232,
+	173,50,10,234,110,231,223,182,10,124,246,232,254,100,9,52,77,231,97,77,9,244,126,232,
+	86,83,9,120,174,233,122,116,9,241,140,231,61,102,9,72,63,233,113,160,9,253,199,233,
+	154,200,8,144,244,231,40,119,9,146,21,231,95,164,10,124,32,231,39,207,8,17,155,232,
+	17,82,9,201,35,233,89,184,10,148,93,233,52,99,10,111,38,231,135,60,9,59,242,232,
+	226,224,9,75,70,232,122,109,9,109,98,231,183,41,10,187,149,231,210,43,9,106,50,233,
+	18,69,9,63,53,233,127,117,9,6,230,232,206,58,9,73,243,232,31,46,10,175,226,232,
+	66,186,9,70,36,234,188,60,9,193,254,232,96,18,10,36,64,233,77,103,9,247,50,233,
+	92,245,9,136,157,230,141,91,9,226,211,233,226,0,10,135,95,230,23,170,9,160,46,234,
+	154,60,9,163,206,230,118,86,9,234,30,233,76,225,9,71,29,233,131,208,8,208,151,232,
+	144,178,8,161,131,232,165,149,10,222,200,232,236,83,9,69,171,233,94,98,9,114,243,233,
+	170,127,9,202,32,231,65,199,10,129,148,231,220,2,10,21,90,230,134,101,9,134,50,233,
+	243,69,9,9,80,233,0,108,9,41,27,233,139,246,9,249,29,234,104,6,10,129,178,232,
+	144,234,7,75,11,229,112,176,8,185,121,232,3,196,9,157,28,233,148,94,8,137,16,231,
+	72,77,9,92,63,233,141,60,10,238,233,231,83,85,9,230,57,233,217,101,10,210,216,232,
+	85,87,9,133,32,233,7,31,9,22,213,232,53,101,10,238,202,233,180,192,10,150,251,231,
+	64,227,9,251,124,233,202,224,10,113,19,232,227,141,9,238,15,234,42,46,9,66,52,233,
+	178,70,9,106,81,231,18,69,9,114,130,231,46,99,9,104,30,233,53,247,6,102,237,244,
+	207,104,10,37,102,235,6,71,9,87,17,244,81,250,7,94,19,238,241,37,8,234,228,239,
+	229,183,7,50,162,236,124,154,7,46,178,240,127,242,7,34,48,237,61,204,6,112,157,243,
+	46,0,8,102,241,238,221,213,7,183,55,239,137,108,6,233,81,243,17,116,8,114,71,238,
+	235,36,11,49,1,243,5,249,7,187,152,239,16,83,9,215,165,241,6,207,7,42,178,240,
+	69,23,9,193,153,235,108,12,9,79,97,245,193,182,6,217,223,243,167,111,7,240,247,243,
+	191,101,8,130,222,238,200,230,7,25,203,237,33,30,8,160,40,240,81,159,6,159,177,243,
+	129,208,9,44,89,241,213,87,8,221,124,240,97,192,7,10,51,240,50,69,8,48,208,238,
+	32,161,7,156,190,238,150,66,8,43,139,238,97,198,6,9,216,243,166,15,8,108,133,240,
+	230,11,8,211,120,239,104,18,8,54,2,240,78,106,8,43,148,239,164,139,7,252,146,238,
+	23,211,6,255,72,246,89,116,6,227,96,243,249,250,7,187,143,238,227,235,7,60,129,240,
+	40,111,9,50,140,237,137,227,7,15,130,238,107,238,6,52,106,244,93,145,8,240,8,238,
+	107,27,7,8,22,246,169,49,8,227,150,238,155,185,7,155,139,240,170,21,8,31,234,239,
+	213,6,7,89,133,243,37,202,7,30,80,247,25,204,7,234,172,239,42,201,7,112,102,241,
+	121,188,7,175,145,238,128,145,7,223,137,238,141,12,8,187,143,238,29,245,7,207,51,239,
+	209,215,7,235,135,238,6,137,7,48,46,237,249,138,7,25,250,236,43,84,8,5,201,238,
+	60,198,7,163,109,240,197,105,7,162,41,237,240,212,8,114,124,240,138,90,9,51,184,237,
+	166,133,8,81,114,239,123,70,8,195,207,236,53,241,7,48,245,239,208,92,9,239,201,234,
+	110,59,8,90,159,238,205,139,10,76,248,239,96,146,10,182,105,235,109,196,6,199,240,243,
+	143,109,8,175,126,239,237,224,7,170,94,240,65,73,9,43,22,235,193,45,8,75,157,239,
+	34,205,9,3,82,244,65,180,10,2,250,236,61,46,9,35,114,235,145,190,6,47,154,243,
+	83,121,9,14,52,235,181,178,7,125,218,239,57,32,7,118,142,243,221,219,6,136,153,243,
+	85,194,7,65,228,239,144,150,8,71,139,237,125,235,6,44,191,244,168,146,8,87,178,237,
+	52,170,9,252,40,242,199,127,8,149,112,237,49,97,8,71,148,238,146,53,8,247,142,239,
+	133,192,6,75,219,243,246,245,8,144,163,241,108,31,8,175,80,237,73,156,7,130,44,241,
+	219,110,8,236,223,237,133,187,9,53,13,235,132,152,8,170,192,237,224,129,7,57,118,239,
+	180,192,10,166,136,245,173,109,7,198,35,237,154,238,7,227,215,239,128,58,10,104,193,236,
+	30,133,7,250,68,237,61,201,9,82,79,243,200,133,7,136,62,247,185,13,7,139,90,246,
+	137,233,6,63,174,244,161,229,6,61,230,244,116,16,8,225,43,240,211,85,8,126,20,241,
+	213,0,8,131,22,239,124,229,7,160,12,240,14,75,8,12,158,238,177,12,7,84,254,244,
+	38,168,8,1,20,238,165,234,8,93,42,236,108,87,8,87,108,240,92,26,7,250,254,244,
+	68,54,9,30,22,235,40,118,7,128,233,244,183,19,8,207,51,239,54,213,7,86,155,239,
+	30,164,9,175,158,238,249,0,7,237,28,245,86,160,8,138,11,238,127,139,8,34,173,237,
+	247,222,7,39,89,237,174,90,8,172,201,238,237,128,8,105,33,238,31,86,8,163,156,239,
+	141,165,8,57,6,239,217,172,7,48,245,239,149,113,7,221,31,237,212,175,7,114,210,240,
+	26,45,8,188,59,238,49,22,9,168,113,239,45,172,7,38,220,236,44,160,7,77,141,240,
+	122,57,8,231,19,239,234,80,8,196,197,238,116,148,7,36,12,241,33,167,6,135,181,243,
+	223,181,7,37,177,240,139,19,9,184,131,235,10,84,9,54,155,240,62,61,9,112,71,238,
+	119,111,6,168,92,243,132,186,7,85,108,240,220,220,7,90,174,240,208,140,7,249,11,239,
+	94,248,7,247,133,238,193,51,7,192,227,243,22,129,8,198,29,238,249,126,9,132,167,235,
+	55,82,8,138,151,238,9,171,6,176,188,243,186,88,8,239,148,238,148,225,7,177,51,240,
+	23,13,9,106,164,239,185,241,8,184,31,238,214,245,8,91,11,239,42,28,10,26,95,236,
+	222,48,9,246,40,237,187,185,8,230,247,238,228,167,8,46,1,239,82,74,10,10,107,235,
+	21,249,8,6,71,237,127,92,9,48,12,238,35,85,9,197,168,238,219,138,8,212,160,242,
+	131,112,9,180,123,237,195,39,9,122,237,238,238,232,8,122,76,238,1,77,8,104,45,238,
+	174,90,8,35,210,238,9,165,7,170,38,240,116,240,6,232,114,244,115,150,7,148,187,242,
+	189,129,8,145,24,238,232,107,8,84,72,236,180,120,10,192,94,241,154,210,7,107,17,238,
+	242,169,7,188,230,240,141,143,7,113,248,239,21,32,8,51,133,239,237,133,6,243,135,243,
+	38,71,8,123,9,239,145,184,7,156,171,239,26,211,8,176,243,235,253,172,6,243,135,243,
+	80,70,7,185,135,243,240,18,9,79,114,239,81,244,7,225,183,240,91,76,8,171,1,239,
+	255,243,8,120,162,241,233,211,7,100,250,239,113,237,6,228,230,244,115,72,8,169,141,239,
+	170,146,8,37,14,238,86,152,7,83,171,240,56,26,8,59,15,240,8,131,8,148,140,237,
+	34,69,9,124,4,235,41,127,10,184,154,243,117,153,6,224,208,243,157,188,6,166,162,243,
+	217,178,6,130,168,243,65,245,6,80,157,244,73,202,6,217,223,243,156,71,9,145,84,238,
+	209,237,8,96,32,238,165,14,7,80,51,243,68,149,8,20,231,237,14,203,10,54,8,238,
+	78,158,7,68,3,241,68,252,7,14,121,237,44,181,8,24,16,238,16,247,7,137,245,239,
+	53,116,7,158,127,242,55,113,8,192,193,237,84,150,10,187,132,243,209,221,6,87,142,244,
+	77,240,7,205,156,238,121,194,6,176,216,243,99,235,8,42,21,244,235,109,10,126,152,235,
+	232,180,7,141,31,241,66,186,9,167,139,245,141,5,12,216,52,240,107,59,8,109,49,237,
+	46,134,9,105,28,244,246,78,8,114,155,238,193,17,8,71,251,237,109,190,7,214,8,239,
+	11,0,7,0,158,246,152,23,8,10,202,235,162,244,8,187,239,245,49,102,9,13,5,245,
+	121,40,9,153,80,245,118,60,8,85,137,241,122,29,8,173,173,238,129,14,8,9,154,239,
+	185,219,7,67,200,239,49,222,8,4,1,239,249,150,9,179,86,245,5,255,6,238,0,245,
+	186,191,6,118,84,244,92,20,8,25,249,239,166,236,7,88,43,239,117,147,7,139,85,240,
+	5,6,8,176,99,236,46,117,10,57,75,242,130,89,10,11,112,238,139,221,8,47,144,245,
+	85,69,7,30,249,244,255,179,7,223,156,237,246,78,8,27,25,239,174,96,7,37,25,244,
+	200,2,8,149,14,240,89,241,6,61,202,244,237,2,7,52,45,245,237,127,7,166,25,240,
+	224,254,7,12,251,239,29,217,7,129,69,238,99,158,8,51,77,239,20,163,7,222,99,240,
+	101,233,7,24,249,239,234,86,7,20,214,243,248,125,7,119,23,247,89,104,8,86,239,239,
+	66,114,7,68,234,243,89,110,7,232,15,245,149,106,6,114,101,243,145,59,7,254,145,246,
+	58,254,7,92,131,238,67,31,9,42,99,235,205,174,7,138,207,238,177,154,8,175,153,241,
+	235,8,10,88,7,239,199,172,8,215,148,240,248,22,8,174,210,239,181,47,8,241,92,238,
+	161,64,9,135,102,235,36,237,8,142,230,236,147,197,7,73,223,237,114,100,8,235,50,241,
+	80,175,8,125,13,238,121,126,8,63,1,237,208,56,8,86,25,237,77,112,7,180,207,242,
+	41,84,8,134,191,241,109,65,7,50,204,244,100,5,8,235,144,239,23,180,9,106,67,235,
+	201,127,8,126,41,238,200,99,8,228,57,237,41,243,7,24,221,239,49,206,6,58,180,243,
+	217,13,8,37,247,239,245,97,7,97,38,237,95,74,8,209,24,236,146,149,7,87,112,247,
+	13,212,6,146,207,243,253,35,8,63,159,239,196,99,8,76,46,236,9,40,7,63,252,245,
+	252,132,8,173,108,237,80,153,7,78,189,238,31,203,7,115,148,238,2,131,7,24,248,245,
+	19,157,8,148,140,237,85,63,8,115,220,239,190,135,7,6,119,243,193,176,7,144,229,239,
+	25,211,7,55,178,243,145,53,8,120,168,238,13,206,7,241,120,238,234,161,11,73,202,237,
+	60,57,9,255,107,235,66,52,8,139,58,237,146,25,8,57,146,239,29,168,7,221,196,242,
+	206,140,8,97,32,238,225,135,6,104,200,243,95,111,9,106,133,237,222,76,9,198,48,237,
+	105,24,7,236,237,245,241,43,7,218,254,245,13,81,7,223,55,243,176,137,7,58,204,240,
+	86,35,8,7,173,238,20,246,9,151,165,236,3,172,6,56,165,243,181,172,8,216,12,238,
+	189,10,7,62,205,246,222,154,10,188,117,237,225,4,7,221,245,244,238,180,10,187,39,242,
+	153,189,7,140,155,238,128,79,10,186,169,234,102,205,7,243,57,242,91,123,7,228,197,237,
+	109,98,8,172,118,241,203,23,10,27,249,245,229,170,7,121,168,238,1,149,10,118,17,237,
+	79,150,9,203,40,235,230,218,7,7,62,242,24,129,7,102,140,240,1,125,7,211,90,241,
+	219,179,8,20,78,237,150,94,8,142,220,238,177,143,6,66,109,243,230,23,11,183,26,244,
+	176,9,8,57,171,238,93,151,7,98,153,239,5,130,6,28,171,243,252,48,8,116,212,235,
+	189,4,8,220,104,247,81,167,7,81,53,247,1,214,6,21,214,243,110,128,8,47,171,237,
+	207,187,7,145,183,237,237,252,7,165,44,239,60,39,8,9,52,237,18,41,9,40,53,244,
+	227,78,10,7,59,246,157,182,7,4,38,240,33,80,9,173,96,245,134,27,8,80,142,239,
+	36,149,9,177,74,238,205,149,9,0,243,241,205,43,8,231,56,240,214,228,7,77,100,247,
+	254,38,10,228,214,242,222,101,11,174,135,241,136,199,7,185,246,237,153,10,8,56,146,239,
+	73,196,7,120,177,239,84,162,7,93,180,240,108,198,9,241,198,234,151,135,8,46,171,237,
+	248,147,8,78,21,238,120,117,9,168,203,235,212,28,8,48,208,238,177,6,8,15,139,239,
+	160,191,7,144,139,240,45,56,8,186,239,241,225,251,10,145,227,236,4,209,7,250,12,247,
+	69,30,7,84,254,244,185,225,6,133,190,244,201,8,7,197,249,244,148,25,7,68,246,244,
+	149,100,7,130,46,245,214,103,7,88,39,245,46,6,7,233,215,244,29,251,6,82,54,245,
+	69,31,7,164,184,244,76,33,7,119,237,244,182,125,9,157,117,244,136,74,7,64,227,247,
+	160,64,8,234,70,237,69,24,8,39,194,241,235,177,8,50,161,239,178,103,8,237,69,240,
+	208,177,7,241,52,241,97,61,8,86,211,239,162,92,8,98,205,245,226,226,7,4,29,239,
+	35,2,8,201,66,239,241,168,7,243,222,245,9,34,8,169,169,239,171,193,7,32,216,237,
+	56,157,7,179,225,240,197,217,7,208,232,239,130,111,8,214,124,238,220,91,8,65,152,236,
+	16,116,8,205,242,237,50,41,8,198,6,240,159,195,7,61,197,237,77,243,6,59,124,243,
+	225,151,8,107,63,240,243,169,8,159,231,240,24,149,8,81,86,241,253,7,8,78,254,239,
+	28,120,7,153,45,247,78,244,8,51,31,237,154,142,7,67,63,241,124,104,7,166,15,247,
+	136,102,7,130,21,247,225,136,8,95,42,236,193,226,6,102,205,245,105,246,7,232,0,240,
+	210,166,8,109,227,235,219,10,9,209,217,239,217,144,7,92,159,238,113,231,7,15,130,238,
+	189,232,7,181,92,240,253,51,9,3,131,235,68,218,8,169,2,236,76,156,10,213,186,241,
+	177,131,8,138,11,238,252,244,8,73,84,245,26,73,8,250,174,238,174,145,8,122,149,237,
+	101,114,6,19,89,243,40,249,6,39,195,244,62,46,9,117,191,235,29,126,6,137,125,243,
+	139,54,8,195,140,240,223,112,8,22,24,241,161,98,7,16,95,242,253,41,7,192,58,246,
+	149,231,6,231,137,243,230,80,8,70,186,236,166,146,7,150,240,240,213,131,7,159,40,240,
+	141,18,7,13,238,244,174,56,9,141,127,237,125,74,10,163,151,235,13,153,10,58,179,235,
+	92,232,9,165,217,236,75,37,8,22,96,239,79,201,6,214,51,244,168,146,8,142,155,237,
+	92,164,7,67,64,241,50,161,8,174,81,244,5,124,7,35,50,242,217,41,8,250,230,238,
+	201,200,7,93,39,241,76,155,7,82,153,240,77,237,7,0,225,239,226,96,8,65,243,240,
+	142,15,10,122,36,242,29,114,8,96,116,238,165,8,8,192,221,239,66,108,8,177,214,238,
+	193,141,8,58,241,240,211,194,8,82,212,236,117,22,7,75,191,243,74,65,8,214,208,238,
+	42,215,7,249,239,239,112,128,8,126,13,238,59,42,9,79,92,236,93,117,8,212,227,237,
+	49,166,7,38,245,240,146,124,9,174,223,241,147,162,9,235,26,238,62,67,8,9,89,238,
+	101,131,10,34,28,235,229,39,8,54,30,240,185,67,9,118,100,235,37,174,7,43,101,240,
+	16,122,7,154,46,239,0,208,7,86,80,240,172,62,8,140,2,237,172,221,7,28,34,240,
+	57,123,8,146,224,237,44,159,7,8,173,238,152,141,7,12,41,247,180,166,9,220,39,237,
+	25,210,6,146,207,243,131,68,8,232,179,235,176,135,9,27,141,238,236,156,9,104,102,235,
+	72,224,7,247,142,239,255,43,9,214,168,238,65,36,7,157,35,245,39,231,3,207,189,243,
+	56,76,7,49,54,242,211,132,9,231,128,234,64,239,7,128,116,247,93,199,6,233,2,245,
+	220,88,7,177,92,245,247,84,7,221,158,245,51,117,7,9,5,246,75,83,7,153,211,245,
+	64,120,6,183,117,243,128,151,6,7,188,243,179,99,7,21,40,245,181,174,3,104,43,239,
+	42,33,8,218,54,239,221,11,7,7,195,245,113,198,9,169,185,234,208,242,9,120,43,237,
+	58,243,9,31,45,237,184,133,9,96,26,239,35,84,7,57,11,246,26,38,7,120,28,245,
+	216,51,8,226,193,244,213,133,2,83,229,241,82,75,9,238,93,235,19,43,8,171,59,246,
+	153,215,8,217,104,235,165,155,8,63,207,235,101,169,8,37,173,235,246,66,4,60,133,243,
+	43,136,4,215,113,243,31,192,3,77,138,243,136,41,4,3,170,243,14,53,5,237,28,244,
+	108,197,6,43,18,243,20,170,6,234,244,242,149,79,4,104,118,243,196,78,4,216,116,243,
+	215,108,4,96,147,243,61,91,4,11,103,243,213,188,5,60,137,237,60,248,6,131,232,237,
+	208,54,7,79,87,237,240,45,7,224,67,237,253,93,3,76,174,231,227,70,3,192,226,231,
+	2,191,9,111,215,233,233,221,9,176,143,233,197,103,9,34,62,233,224,107,9,119,58,233,
+	200,96,9,28,71,233,214,98,9,63,44,233,123,208,8,16,183,232,135,102,9,162,55,233,
+	120,216,9,163,149,233,235,109,9,135,73,233,45,124,9,116,34,233,253,244,2,109,218,240,
+	108,107,7,83,219,238,227,46,8,130,72,237,7,127,7,58,52,237,213,134,7,82,61,237,
+	31,209,6,57,123,244,168,157,4,78,241,241,191,55,7,44,195,247,47,207,6,59,225,243,
+	52,136,8,87,172,246,84,200,6,255,99,244,239,35,3,126,170,240,
+};
+
+#define CITY_GRID_LAT0 12
+#define CITY_GRID_LON0 -177
+#define CITY_GRID_STEP 3
+#define CITY_GRID_ROWS 23
+#define CITY_GRID_COLS 42
+
+// Cell row * CITY_GRID_COLS + col holds cityGridEntries[start[cell]..start[cell + 1]]
+static constexpr city_index_t cityGridStart[CITY_GRID_ROWS * CITY_GRID_COLS + 1] PROGMEM = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,12,12,12,
+	12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+	12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+	12,12,12,12,20,67,99,140,140,140,140,140,140,140,140,140,
+	140,140,140,140,140,140,140,140,140,140,140,144,146,146,146,146,
+	146,146,146,146,146,146,146,146,146,146,146,146,146,148,189,248,
+	251,254,260,260,260,260,260,260,260,260,260,260,260,260,260,260,
+	260,260,260,260,265,277,277,277,277,277,277,277,277,277,277,277,
+	277,277,277,277,277,284,295,323,349,372,372,372,377,379,379,379,
+	379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,
+	379,379,379,379,379,379,379,379,379,379,379,379,379,379,381,388,
+	405,421,444,460,460,460,460,460,472,500,500,500,500,500,500,500,
+	500,500,500,500,500,500,500,500,500,500,500,500,500,500,500,500,
+	500,500,500,500,500,500,500,501,504,515,524,524,535,551,561,566,
+	567,568,611,620,620,620,620,620,620,620,620,620,620,620,620,620,
+	620,620,620,620,620,620,620,620,620,620,620,620,620,620,620,620,
+	620,625,630,633,637,642,651,674,689,704,716,730,738,740,740,740,
+	740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,740,
+	740,740,740,740,740,740,740,740,740,740,751,753,758,759,764,765,
+	767,776,785,796,808,829,846,854,860,860,860,860,860,860,860,860,
+	860,860,860,860,860,860,860,860,860,860,860,860,860,860,860,860,
+	860,860,860,872,881,884,885,885,890,892,894,905,921,924,938,951,
+	960,968,980,980,980,980,980,980,980,980,980,980,980,980,980,980,
+	980,980,980,980,980,980,980,980,980,980,980,980,980,983,986,989,
+	991,991,991,995,1001,1007,1009,1019,1038,1050,1057,1068,1090,1099,1100,1100,
+	1100,1100,1100,1100,1100,1100,1100,1100,1100,1100,1100,1100,1100,1100,1100,1100,
+	1100,1100,1100,1100,1100,1100,1101,1103,1103,1105,1108,1109,1110,1112,1114,1115,
+	1118,1124,1129,1139,1157,1180,1193,1207,1218,1219,1220,1220,1220,1220,1220,1220,
+	1220,1220,1220,1220,1220,1220,1220,1220,1220,1220,1220,1220,1220,1220,1220,1220,
+	1222,1244,1247,1251,1255,1257,1257,1259,1261,1267,1275,1280,1283,1286,1293,1295,
+	1297,1320,1326,1329,1335,1338,1338,1338,1340,1340,1340,1340,1340,1340,1340,1340,
+	1340,1340,1340,1340,1340,1340,1340,1340,1340,1341,1350,1357,1364,1369,1379,1382,
+	1392,1402,1417,1427,1429,1430,1432,1435,1436,1439,1440,1441,1446,1449,1452,1452,
+	1459,1460,1460,1461,1461,1461,1461,1461,1461,1461,1461,1461,1461,1461,1461,1461,
+	1461,1463,1463,1464,1469,1473,1477,1490,1499,1512,1542,1559,1565,1566,1569,1572,
+	1572,1572,1572,1573,1573,1574,1574,1574,1575,1575,1576,1580,1580,1580,1580,1580,
+	1580,1582,1583,1583,1584,1584,1584,1584,1584,1584,1584,1593,1602,1604,1608,1619,
+	1640,1650,1666,1670,1677,1680,1682,1689,1692,1692,1693,1693,1693,1693,1694,1694,
+	1694,1695,1695,1696,1696,1696,1696,1696,1696,1696,1696,1697,1698,1708,1713,1721,
+	1721,1721,1721,1723,1731,1740,1743,1743,1746,1748,1751,1752,1755,1757,1759,1759,
+	1760,1760,1762,1762,1762,1762,1762,1763,1763,1763,1765,1766,1767,1767,1767,1767,
+	1767,1767,1767,1767,1771,1775,1781,1781,1782,1793,1825,1832,1835,1837,1846,1852,
+	1852,1853,1855,1859,1861,1865,1868,1869,1869,1869,1870,1870,1871,1873,1873,1873,
+	1873,1874,1877,1877,1881,1881,1881,1881,1881,1881,1881,1881,1881,1882,1885,1887,
+	1888,1889,1890,1894,1905,1915,1919,1921,1923,1923,1923,1924,1928,1928,1929,1929,
+	1931,1931,1931,1931,1931,1932,1932,1934,1934,1934,1935,1935,1936,1936,1936,1937,
+	1937,1937,1937,1937,1937,1937,1937,1937,1937,1939,1943,1944,1944,1947,1948,1950,
+	1950,1951,1953,1956,1956,1958,1958,1958,1958,1959,1959,1959,1959,1959,1959,1959,
+	1960,1960,1961,1962,1963,1963,1963,1963,1963,1963,1965,1965,1965,1965,1965,1965,
+	1965,1965,1965,1966,1967,1969,1969,1972,1973,1973,1974,1974,1974,1976,1976,1976,
+	1979,1980,1981,1981,1981,1981,1982,1982,1982,1982,1983,1984,1984,1984,1985,1985,
+	1985,1985,1985,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,
+	1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,1986,
+	1986,1986,1986,1986,1987,1987,1987,1988,1988,1988,1989,1989,1989,1989,1989,1989,
+	1989,1989,1989,1989,1989,1989,1989,1989,1989,1989,1989,1989,1989,1989,1989,1989,
+	1989,1989,1989,1989,1989,1989,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,
+	1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,
+	1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,1990,
+	1990,1990,1990,1990,1990,1991,1991,1991,1991,1991,1991,1991,1991,1991,1991,1991,
+	1991,1991,1991,1991,1991,1991,1991,
+};
+
+static constexpr city_index_t cityGridEntries[CITY_TABLE_SIZE] PROGMEM = {
+	28,34,81,89,151,185,195,196,221,246,253,285,4,84,150,160,
+	184,208,230,462,9,17,18,20,47,54,62,96,98,99,101,102,
+	107,109,110,113,115,117,119,120,124,125,126,130,131,132,133,135,
+	139,140,146,152,153,228,229,232,249,262,264,265,266,267,268,270,
+	271,272,292,22,24,38,63,78,97,100,121,122,127,138,147,156,
+	159,162,170,172,188,193,200,202,204,205,210,233,241,242,243,269,
+	273,283,284,5,12,15,21,25,27,31,32,33,39,71,87,90,
+	92,93,94,103,114,161,165,171,175,186,192,197,207,213,222,223,
+	235,240,250,252,257,259,274,275,280,281,282,1945,1248,1249,1253,1263,
+	1256,1259,326,389,6,13,45,46,50,59,60,61,64,65,66,67,
+	68,74,108,111,118,123,129,137,145,154,173,199,209,254,256,258,
+	295,296,297,298,342,451,457,458,459,460,461,1979,1990,3,7,10,
+	11,14,16,26,29,36,40,41,42,43,44,48,49,51,52,53,
+	55,56,69,70,72,75,77,79,112,116,128,134,136,143,144,155,
+	164,166,177,178,183,190,201,214,217,227,247,248,261,276,277,278,
+	279,286,287,288,289,290,291,294,35,80,104,88,163,198,19,58,
+	91,157,158,236,1245,1246,1250,1252,1966,1243,1244,1247,1251,1254,1255,1257,
+	1258,1260,1261,1262,1967,325,345,393,396,418,420,443,306,307,313,315,
+	335,346,348,402,412,415,417,302,303,305,311,314,317,322,329,330,
+	332,349,351,354,358,359,374,381,390,392,405,406,410,429,436,438,
+	446,452,455,37,85,142,149,181,191,203,218,219,237,244,300,301,
+	304,310,319,320,321,323,353,382,388,399,409,423,435,0,1,8,
+	23,73,82,83,95,167,168,179,180,187,211,212,215,224,225,231,
+	234,239,251,255,57,76,148,174,226,206,293,422,432,312,324,333,
+	397,398,428,1935,316,328,334,343,363,370,378,383,403,407,413,416,
+	419,425,426,442,454,336,339,340,357,360,371,372,375,376,377,385,
+	404,408,414,439,453,106,176,182,189,194,216,220,238,263,308,318,
+	337,341,352,362,384,387,411,427,450,860,866,876,2,30,86,105,
+	141,245,260,806,811,818,821,843,852,855,856,858,465,510,524,539,
+	543,547,550,553,561,563,576,1953,506,507,508,513,515,516,520,534,
+	535,536,537,538,541,542,544,552,554,556,558,559,562,566,567,577,
+	580,581,583,1923,456,338,401,448,299,327,364,365,366,368,379,391,
+	431,437,441,344,356,380,386,424,433,434,444,445,169,350,355,369,
+	373,394,400,798,816,842,1128,463,796,800,808,814,822,825,826,833,
+	834,837,844,857,863,865,867,799,804,810,823,827,829,831,853,861,
+	868,668,674,675,676,688,679,501,500,502,503,504,505,511,512,518,
+	519,522,523,527,528,529,531,532,540,545,546,548,551,555,560,564,
+	565,569,570,572,573,574,575,578,579,582,586,587,588,1951,1952,1958,
+	1959,1960,1961,509,517,521,525,526,533,568,571,1954,309,347,395,430,
+	1066,331,367,421,1064,1143,361,440,447,449,1112,1129,1130,1110,1113,1127,
+	1133,1139,812,813,840,870,1126,1131,1136,1137,1138,464,797,801,802,805,
+	807,809,815,817,820,824,828,832,841,846,847,849,851,854,859,862,
+	872,874,671,677,684,687,795,803,819,835,836,839,848,850,871,873,
+	875,667,669,670,672,673,680,681,682,683,685,689,690,718,726,1985,
+	470,477,584,678,686,715,717,720,721,722,723,725,467,474,480,514,
+	530,557,585,590,594,595,596,607,608,615,549,592,597,601,603,605,
+	606,612,616,766,1068,1076,1079,1082,1087,1089,1090,1092,1093,1096,1099,1062,
+	1070,1060,1061,1063,1065,1144,1114,1107,1108,1111,1115,1116,1132,1135,1142,751,
+	753,758,759,760,763,830,845,864,484,485,490,492,493,756,761,838,
+	869,483,486,487,488,489,494,495,496,497,716,724,471,472,475,478,
+	481,482,714,719,727,728,785,791,466,468,469,473,476,479,589,591,
+	599,600,602,604,609,611,614,778,781,784,789,790,794,593,598,610,
+	613,732,736,738,741,765,770,771,772,773,774,775,776,777,729,731,
+	739,743,764,767,768,769,730,733,734,740,744,1955,1067,1071,1075,1078,
+	1080,1083,1086,1088,1091,1094,1097,1962,1069,1072,1077,1081,1085,1095,1098,1100,
+	1122,1119,1121,1124,1140,1102,1103,1105,1109,1117,1101,1118,639,1134,638,642,
+	643,644,646,647,648,650,651,755,757,491,634,635,636,637,640,645,
+	703,706,707,708,709,712,752,754,762,498,710,713,617,619,620,622,
+	625,626,629,653,664,666,711,783,787,793,632,654,655,657,659,662,
+	663,665,779,780,782,786,788,656,660,750,792,877,881,885,892,894,
+	737,742,880,886,887,888,889,891,693,694,696,698,700,735,878,879,
+	882,883,884,890,1073,1074,1084,1120,1125,1193,1123,1191,1192,1141,1205,1104,
+	1161,1188,1189,641,649,652,981,1106,1190,980,982,984,985,986,987,704,
+	705,628,900,901,904,905,906,915,917,976,977,618,621,623,624,627,
+	902,903,907,908,909,911,912,913,914,916,918,919,920,923,630,631,
+	633,658,661,922,924,925,926,927,949,1022,748,749,895,1020,1021,1023,
+	1025,893,1024,1026,1031,1033,1035,1036,1038,1040,1042,1059,499,691,692,695,
+	697,699,701,702,745,746,747,991,1027,1028,1029,1030,1032,1034,1037,1039,
+	1041,1043,896,897,992,994,995,996,998,1012,1014,936,1196,1194,1200,1162,
+	1198,1163,1168,1169,1232,1231,1203,1204,1046,1202,983,898,969,973,899,910,
+	1050,1052,1053,1056,921,1051,1054,1057,1058,942,948,950,951,953,954,955,
+	956,1956,1957,947,952,957,960,1419,1422,1449,1491,1495,1560,1599,1603,1619,
+	1686,1766,1860,1863,1932,993,1004,1019,1430,1435,1442,1483,1504,1555,1569,1618,
+	1620,1622,1637,1711,1716,1737,1746,1770,1774,1916,1933,1987,997,1003,1005,1006,
+	1007,1008,1011,1015,1017,1660,1878,1984,1989,934,935,999,1000,1001,1002,1009,
+	1010,1013,1016,1018,1047,1048,1927,928,929,930,931,932,933,937,941,988,
+	989,990,938,1448,1195,1206,1148,1197,1199,1207,1208,1210,1211,1213,1214,1215,
+	1217,1218,1222,1224,1225,1226,1227,1228,1229,1230,1964,1965,1166,1221,1963,1164,
+	1165,1167,1176,1170,1171,1177,1181,1175,1180,1183,1187,1185,1201,965,972,978,
+	979,1044,1045,961,962,964,967,970,971,974,975,963,966,1049,1055,1924,
+	944,958,959,943,945,946,1460,1494,1604,1625,1742,1835,1868,1565,1894,1454,
+	1590,1411,1498,1520,1521,1527,1531,1610,1621,1635,1659,1668,1673,1705,1750,1804,
+	1805,1806,1807,1810,1812,1813,1861,1872,940,1537,1674,1811,1922,1943,939,1846,
+	1937,1456,1519,1719,1740,1741,1867,1648,1687,1748,1815,1986,1416,1223,1469,1470,
+	1473,1513,1546,1550,1713,1982,1209,1212,1216,1220,1516,1669,1983,1219,1698,1755,
+	1776,1790,1827,1834,1172,1173,1447,1464,1465,1440,1563,1647,1690,1721,1752,1758,
+	1850,1913,1980,1174,1511,1908,1178,1179,1493,1496,1545,1597,1601,1727,1769,1792,
+	1438,1472,1561,1589,1663,1675,1679,1781,1871,1907,1182,1184,1186,1417,1458,1547,
+	1551,1556,1613,1743,1762,1793,1800,1828,1885,1507,1554,1596,1628,1640,1820,1842,
+	1870,1880,1900,968,1763,1882,1632,1866,1591,1703,1735,1726,1431,1681,1684,1671,
+	1533,1685,1808,1809,1928,1934,1825,1929,1931,1723,1930,1942,1518,1682,1773,1840,
+	1843,1844,1914,1715,1392,1649,1771,1664,1418,1643,1702,1733,1778,1506,1540,1629,
+	1981,1414,1433,1595,1646,1450,1453,1457,1466,1468,1548,1564,1677,1688,1695,1722,
+	1730,1851,1420,1480,1636,1654,1729,1744,1768,1798,1883,1421,1444,1467,1524,1534,
+	1552,1598,1662,1777,1823,1824,1877,1936,1415,1425,1459,1462,1478,1487,1503,1514,
+	1535,1609,1631,1655,1656,1661,1680,1694,1706,1710,1712,1717,1734,1783,1791,1799,
+	1826,1829,1886,1890,1896,1920,1434,1445,1485,1522,1525,1571,1614,1672,1676,1786,
+	1833,1839,1847,1852,1905,1909,1911,1427,1443,1451,1562,1606,1864,1884,1463,1653,
+	1817,1754,1761,1801,1728,1944,1947,1803,1461,1772,1787,1926,1319,1395,1336,1393,
+	1150,1152,1157,1158,1234,1236,1917,1949,1950,1147,1149,1151,1233,1593,1714,1718,
+	1845,1848,1831,1869,1477,1701,1709,1910,1497,1501,1539,1615,1720,1724,1775,1795,
+	1816,1859,1879,1455,1499,1508,1510,1528,1538,1542,1566,1592,1612,1626,1633,1700,
+	1736,1747,1796,1832,1856,1897,1899,1912,1423,1441,1502,1568,1570,1587,1708,1830,
+	1889,1903,1432,1439,1471,1526,1541,1544,1553,1578,1588,1600,1607,1645,1765,1858,
+	1891,1895,1476,1484,1670,1678,1446,1543,1611,1683,1725,1818,1821,1530,1819,1836,
+	1437,1693,1523,1699,1837,1838,1865,1887,1892,1691,1704,1756,1583,1881,1822,1988,
+	1318,1328,1264,1276,1286,1287,1292,1320,1323,1326,1338,1352,1321,1334,1355,1379,
+	1380,1285,1289,1303,1308,1322,1332,1401,1974,1159,1160,1153,1154,1237,1239,1240,
+	1241,1242,1689,1145,1146,1155,1156,1235,1238,1428,1557,1948,1529,1602,1854,1697,
+	1841,1893,1580,1764,1573,1624,1630,1586,1574,1577,1657,1549,1605,1572,1849,1474,
+	1505,1608,1638,1429,1857,1667,1650,1272,1309,1331,1376,1269,1295,1353,1384,1335,
+	1346,1349,1361,1408,1409,1347,1277,1314,1315,1316,1329,1339,1359,1365,1366,1369,
+	1389,1266,1274,1281,1282,1290,1293,1297,1304,1310,1312,1327,1330,1350,1356,1363,
+	1364,1371,1377,1387,1388,1396,1398,1400,1407,1410,1970,1971,1972,1973,1975,1977,
+	1978,1280,1298,1305,1348,1373,1382,1383,1273,1333,1406,1479,1925,1486,1492,1532,
+	1616,1696,1760,1906,1919,1946,1490,1567,1732,1797,1853,1862,1898,1576,1739,1452,
+	1584,1738,1873,1475,1581,1559,1623,1784,1918,1582,1585,1921,1941,1558,1426,1785,
+	1901,1413,1644,1779,1814,1651,1652,1658,1782,1386,1340,1372,1374,1306,1341,1265,
+	1311,1360,1284,1325,1391,1394,1267,1271,1279,1296,1299,1307,1337,1342,1378,1404,
+	1969,1268,1270,1275,1283,1288,1300,1301,1351,1968,1976,1291,1368,1375,1390,1794,
+	1938,1509,1707,1745,1876,1915,1939,1940,1902,1536,1692,1436,1500,1888,1517,1488,
+	1641,1324,1358,1294,1317,1344,1362,1397,1278,1367,1399,1370,1302,1402,1753,1412,
+	1904,1579,1639,1874,1515,1575,1666,1594,1665,1788,1617,1757,1780,1354,1385,1403,
+	1405,1343,1345,1381,1357,1313,1482,1875,1489,1759,1802,1749,1627,1481,1855,1751,
+	1634,1512,1789,1424,1767,1731,1642,
+};
+
+#define CITY_NAMES 0 // Generate with --names for cityName()
@@ -1,12 +1,52 @@
 // OpenWeatherOneCall v3.1.8
 // www.github.com/jhershey69
 
-#include <time.h>
-#include <stdio.h>
-#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+static const char weekDays[] = "SunMonTueWedThuFriSat";
+
+// Two digits, no terminator
+static char *put2(char *out, int value)
+{
+    out[0] = '0' + value / 10;
+    out[1] = '0' + value % 10;
+    return out + 2;
+}
+
+static char *putDate(char *out, int first, int second, int year, char separator)
+{
+    out = put2(out, first);
+    *out++ = separator;
+    out = put2(out, second);
+    *out++ = separator;
+    out = put2(out, year / 100);
+    return put2(out, year % 100);
+}
+
+// hh:mm as %R prints it
+static char *put24(char *out, int hour, int minute)
+{
+    out = put2(out, hour);
+    *out++ = ':';
+    return put2(out, minute);
+}
+
+// hh:mm AM, %r without the seconds
+static char *put12(char *out, int hour, int minute)
+{
+    out = put24(out, (hour % 12) ? hour % 12 : 12, minute);
+    *out++ = ' ';
+    *out++ = (hour < 12) ? 'A' : 'P';
+    *out++ = 'M';
+    return out;
+}
 
 // Takes any EPOCH time converts to Human Readable
-void dateTimeConversion(long _epoch, char *_buffer, int _format)
+// The caller has already added the timezone offset, so the epoch is read
+// as UTC with integer arithmetic only: no localtime(), no TZ, reentrant.
+// At most _size bytes are written, the result is cut to fit and terminated.
+void dateTimeConversion(long _epoch, char *_buffer, size_t _size, int _format)
 {
 
     /*FORMAT RETURNS
@@ -15,54 +55,96 @@ void dateTimeConversion(long _epoch, char *_buffer, int _format)
     3 M/D/Y 12H
     4 D/M/Y 12H
     5/6 TIME ONLY 24H
-    7/8 TIME ONLY 12H
+    7/8 TIME ONLY 12H, hh:mm AM
     9 DAY SHORTNAME
 	10 Y-M-D Day history call
     */
 
+    int64_t epoch = _epoch;
+    int64_t days = epoch / 86400;
+    int32_t seconds = (int32_t)(epoch % 86400);
+    if(seconds < 0)
+        {
+            seconds += 86400;
+            days--;
+        }
+
+    int hour = seconds / 3600;
+    int minute = seconds / 60 % 60;
+    int weekDay = (int)((days % 7 + 11) % 7); // 1970-01-01 was a Thursday
+
+    // Civil date from days since 1970-01-01, eras of 400 years from March 1st
+    int64_t shifted = days + 719468;
+    int64_t era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+    int32_t dayOfEra = (int32_t)(shifted - era * 146097);
+    int32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int32_t monthIndex = (5 * dayOfYear + 2) / 153;
+    int day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    int month = (monthIndex < 10) ? monthIndex + 3 : monthIndex - 9;
+    int year = (int)(yearOfEra + era * 400 + (month <= 2));
+    if((year < 0) || (year > 9999)) year = 0;
 
-    time_t rawtime = _epoch;
-    struct tm *ptm = localtime(&rawtime);
+    if(_size == 0) return;
+
+    char text[20]; // the longest, MM/DD/YYYY hh:mm AM
+    char *out = text;
     switch (_format)
         {
 
-        case 1:
-            // M/D/Y 24H
-            strftime(_buffer,20,"%m/%d/%Y %R",ptm);
-            break;
         case 2:
             // D/M/Y 24H
-            strftime(_buffer,20,"%d/%m/%Y %R",ptm);
+            out = putDate(out, day, month, year, '/');
+            *out++ = ' ';
+            out = put24(out, hour, minute);
             break;
         case 3:
-            // M/D/Y 12H
-            strftime(_buffer,20,"%m/%d/%Y %r",ptm);
+            // M/D/Y 12H, hh:mm AM to fit the 20 character fields
+            out = putDate(out, month, day, year, '/');
+            *out++ = ' ';
+            out = put12(out, hour, minute);
             break;
         case 4:
-            // D/M/Y 12H
-            strftime(_buffer,20,"%d/%m/%Y %r",ptm);
+            // D/M/Y 12H, hh:mm AM to fit the 20 character fields
+            out = putDate(out, day, month, year, '/');
+            *out++ = ' ';
+            out = put12(out, hour, minute);
             break;
         case 5:
         case 6:
             // 24 HOUR TIME ONLY
-            strftime(_buffer,20,"%R",ptm);
+            out = put24(out, hour, minute);
             break;
         case 7:
         case 8:
             // 12 HOUR TIME ONLY
-            strftime(_buffer,20,"%r",ptm);
+            out = put12(out, hour, minute);
             break;
         case 9:
             // DAY SHORTNAME
-            strftime(_buffer,20,"%a",ptm);
+            *out++ = weekDays[3 * weekDay];
+            *out++ = weekDays[3 * weekDay + 1];
+            *out++ = weekDays[3 * weekDay + 2];
             break;
 		case 10:
             // Y-M-D
-            strftime(_buffer,20,"%Y-%m-%d",ptm);
+            out = put2(out, year / 100);
+            out = put2(out, year % 100);
+            *out++ = '-';
+            out = put2(out, month);
+            *out++ = '-';
+            out = put2(out, day);
             break;
+        case 1:
         default:
             // M/D/Y 24H
-            strftime(_buffer,20,"%m/%d/%Y %R",ptm);
+            out = putDate(out, month, day, year, '/');
+            *out++ = ' ';
+            out = put24(out, hour, minute);
         }
+    size_t length = (size_t)(out - text);
+    if(length >= _size) length = _size - 1;
+    for(size_t c = 0; c < length; c++) _buffer[c] = text[c];
+    _buffer[length] = '\0';
 
 }
@@ -0,0 +1,631 @@
+/*
+   FieldMap.cpp
+   Descriptor tables and the generic fill routines, see FieldMap.h
+   Adding a field to a result struct is one line in its table.
+*/
+
+#include "FieldMap.h"
+#include "WeatherConditions.h"
+#include <stddef.h>
+
+typedef OpenWeatherOneCall::nowData NOW;
+typedef OpenWeatherOneCall::futureData DAY;
+typedef OpenWeatherOneCall::HOURLY HOUR;
+typedef OpenWeatherOneCall::MINUTELY MINUTE;
+typedef OpenWeatherOneCall::ALERTS ALERT;
+typedef OpenWeatherOneCall::HISTORICAL PAST;
+typedef OpenWeatherOneCall::airQuality AIR;
+
+#define FIELD(key,type,st,member) {key,type,0,offsetof(st,member),NULL}
+#define NESTED(key,type,table) {key,type,0,0,&table}
+#define CONDITION(key,type,st,member,table) {key,type,0,offsetof(st,member),&table}
+#define COLD_FIELD(key,type,st,member) {key,type,1,offsetof(st,member),NULL}
+#define COLD_CONDITION(key,type,st,member,table) {key,type,1,offsetof(st,member),&table}
+#define FIELD_COUNT(fields) (sizeof(fields) / sizeof(fields[0]))
+#define FIELD_TABLE(name,fields) \
+    static_assert(keysSorted(fields,FIELD_COUNT(fields)), #fields " keys must be sorted"); \
+    constexpr FieldTable name = {fields,FIELD_COUNT(fields)}
+
+// Keys are compared like strcmp() does, binary search depends on it
+constexpr bool keyLess(const char *a, const char *b)
+{
+    return (*a == *b) ? (*a && keyLess(a + 1, b + 1)) : ((unsigned char)*a < (unsigned char)*b);
+}
+
+constexpr bool keysSorted(const FieldMap *fields, size_t count)
+{
+    return (count < 2) || (keyLess(fields[0].key, fields[1].key) && keysSorted(fields + 1, count - 1));
+}
+
+// "weather":[{...}] and "rain"/"snow":{"1h":...} repeat in several structs
+#define WEATHER_TABLE(name,st) \
+    constexpr FieldMap name##_id_fields[] = { \
+        FIELD("id",FIELD_WHOLE,st,id) \
+    }; \
+    FIELD_TABLE(name##_id,name##_id_fields); \
+    constexpr FieldMap name##_fields[] = { \
+        CONDITION("description",FIELD_DESCRIPTION,st,summary,name##_id), \
+        FIELD("icon",FIELD_ICON,st,icon), \
+        FIELD("id",FIELD_WHOLE,st,id), \
+        CONDITION("main",FIELD_MAIN,st,main,name##_id) \
+    }; \
+    FIELD_TABLE(name,name##_fields)
+
+// OWOC_SPLIT_RECORDS: the text goes to the recordText in FillOptions::cold,
+// the id stays with the numbers
+#ifdef OWOC_SPLIT_RECORDS
+typedef OpenWeatherOneCall::recordText TEXT;
+#define RECORD_WEATHER_TABLE(name,st) \
+    constexpr FieldMap name##_id_fields[] = { \
+        FIELD("id",FIELD_WHOLE,st,id) \
+    }; \
+    FIELD_TABLE(name##_id,name##_id_fields); \
+    constexpr FieldMap name##_fields[] = { \
+        COLD_CONDITION("description",FIELD_DESCRIPTION,TEXT,summary,name##_id), \
+        COLD_FIELD("icon",FIELD_ICON,TEXT,icon), \
+        FIELD("id",FIELD_WHOLE,st,id), \
+        COLD_CONDITION("main",FIELD_MAIN,TEXT,main,name##_id) \
+    }; \
+    FIELD_TABLE(name,name##_fields)
+#else
+#define RECORD_WEATHER_TABLE WEATHER_TABLE
+#endif
+
+#define ONE_HOUR_TABLE(name,st,member) \
+    constexpr FieldMap name##_fields[] = { \
+        FIELD("1h",FIELD_VOLUME,st,member) \
+    }; \
+    FIELD_TABLE(name,name##_fields)
+
+// current
+WEATHER_TABLE(current_weather,NOW);
+ONE_HOUR_TABLE(current_rain,NOW,rainVolume);
+ONE_HOUR_TABLE(current_snow,NOW,snowVolume);
+
+constexpr FieldMap current_fields[] =
+{
+    FIELD("clouds",FIELD_WHOLE,NOW,cloudCover),
+    FIELD("dew_point",FIELD_FIXED,NOW,dewPoint),
+    FIELD("dt",FIELD_LONG,NOW,dayTime),
+    FIELD("feels_like",FIELD_FIXED,NOW,apparentTemperature),
+    FIELD("humidity",FIELD_WHOLE,NOW,humidity),
+    FIELD("pressure",FIELD_WHOLE,NOW,pressure),
+    NESTED("rain",FIELD_OBJECT,current_rain),
+    NESTED("snow",FIELD_OBJECT,current_snow),
+    FIELD("sunrise",FIELD_LONG,NOW,sunriseTime),
+    FIELD("sunset",FIELD_LONG,NOW,sunsetTime),
+    FIELD("temp",FIELD_FIXED,NOW,temperature),
+    FIELD("uvi",FIELD_SMALL,NOW,uvIndex),
+    FIELD("visibility",FIELD_WHOLE,NOW,visibility),
+    NESTED("weather",FIELD_FIRST,current_weather),
+    FIELD("wind_deg",FIELD_WHOLE,NOW,windBearing),
+    FIELD("wind_gust",FIELD_SMALL,NOW,windGust),
+    FIELD("wind_speed",FIELD_SMALL,NOW,windSpeed)
+};
+FIELD_TABLE(map_current,current_fields);
+
+// daily
+RECORD_WEATHER_TABLE(daily_weather,DAY);
+
+constexpr FieldMap daily_temp_fields[] =
+{
+    FIELD("day",FIELD_FIXED,DAY,temperatureDay),
+    FIELD("eve",FIELD_FIXED,DAY,temperatureEve),
+    FIELD("max",FIELD_FIXED,DAY,temperatureHigh),
+    FIELD("min",FIELD_FIXED,DAY,temperatureLow),
+    FIELD("morn",FIELD_FIXED,DAY,temperatureMorn),
+    FIELD("night",FIELD_FIXED,DAY,temperatureNight)
+};
+FIELD_TABLE(daily_temp,daily_temp_fields);
+
+constexpr FieldMap daily_feels_like_fields[] =
+{
+    FIELD("day",FIELD_FIXED,DAY,apparentTemperatureHigh),
+    FIELD("eve",FIELD_FIXED,DAY,apparentTemperatureEve),
+    FIELD("morn",FIELD_FIXED,DAY,apparentTemperatureMorn),
+    FIELD("night",FIELD_FIXED,DAY,apparentTemperatureLow)
+};
+FIELD_TABLE(daily_feels_like,daily_feels_like_fields);
+
+constexpr FieldMap daily_fields[] =
+{
+    FIELD("clouds",FIELD_WHOLE,DAY,cloudCover),
+    FIELD("dew_point",FIELD_FIXED,DAY,dewPoint),
+    FIELD("dt",FIELD_LONG,DAY,dayTime),
+    NESTED("feels_like",FIELD_OBJECT,daily_feels_like),
+    FIELD("humidity",FIELD_WHOLE,DAY,humidity),
+    FIELD("pop",FIELD_SMALL,DAY,pop),
+    FIELD("pressure",FIELD_WHOLE,DAY,pressure),
+    FIELD("rain",FIELD_VOLUME,DAY,rainVolume), // daily has no "1h"
+    FIELD("snow",FIELD_VOLUME,DAY,snowVolume),
+    FIELD("sunrise",FIELD_LONG,DAY,sunriseTime),
+    FIELD("sunset",FIELD_LONG,DAY,sunsetTime),
+    NESTED("temp",FIELD_OBJECT,daily_temp),
+    FIELD("uvi",FIELD_SMALL,DAY,uvIndex),
+    NESTED("weather",FIELD_FIRST,daily_weather),
+    FIELD("wind_deg",FIELD_WHOLE,DAY,windBearing),
+    FIELD("wind_gust",FIELD_SMALL,DAY,windGust),
+    FIELD("wind_speed",FIELD_SMALL,DAY,windSpeed)
+};
+FIELD_TABLE(map_daily,daily_fields);
+
+// hourly
+WEATHER_TABLE(hourly_weather,HOUR);
+ONE_HOUR_TABLE(hourly_rain,HOUR,rainVolume);
+ONE_HOUR_TABLE(hourly_snow,HOUR,snowVolume);
+
+constexpr FieldMap hourly_fields[] =
+{
+    FIELD("clouds",FIELD_WHOLE,HOUR,cloudCover),
+    FIELD("dew_point",FIELD_FIXED,HOUR,dewPoint),
+    FIELD("dt",FIELD_LONG,HOUR,dayTime),
+    FIELD("feels_like",FIELD_FIXED,HOUR,apparentTemperature),
+    FIELD("humidity",FIELD_WHOLE,HOUR,humidity),
+    FIELD("pop",FIELD_SMALL,HOUR,pop),
+    FIELD("pressure",FIELD_WHOLE,HOUR,pressure),
+    NESTED("rain",FIELD_OBJECT,hourly_rain),
+    NESTED("snow",FIELD_OBJECT,hourly_snow),
+    FIELD("temp",FIELD_FIXED,HOUR,temperature),
+    FIELD("visibility",FIELD_WHOLE,HOUR,visibility),
+    NESTED("weather",FIELD_FIRST,hourly_weather),
+    FIELD("wind_deg",FIELD_WHOLE,HOUR,windBearing),
+    FIELD("wind_speed",FIELD_SMALL,HOUR,windSpeed)
+};
+FIELD_TABLE(map_hourly,hourly_fields);
+
+// minutely
+constexpr FieldMap minutely_fields[] =
+{
+    FIELD("dt",FIELD_LONG,MINUTE,dayTime),
+    FIELD("precipitation",FIELD_FIXED,MINUTE,precipitation)
+};
+FIELD_TABLE(map_minutely,minutely_fields);
+
+// alerts
+constexpr FieldMap alerts_fields[] =
+{
+    FIELD("description",FIELD_STRING,ALERT,summary),
+    FIELD("end",FIELD_LONG,ALERT,alertEnd),
+    FIELD("event",FIELD_STRING,ALERT,event),
+    FIELD("sender_name",FIELD_STRING,ALERT,senderName),
+    FIELD("start",FIELD_LONG,ALERT,alertStart)
+};
+FIELD_TABLE(map_alerts,alerts_fields);
+
+// timemachine "data":[{...}]
+RECORD_WEATHER_TABLE(timemachine_weather,PAST);
+ONE_HOUR_TABLE(timemachine_rain,PAST,rainVolume);
+ONE_HOUR_TABLE(timemachine_snow,PAST,snowVolume);
+
+constexpr FieldMap timemachine_fields[] =
+{
+    FIELD("clouds",FIELD_WHOLE,PAST,cloudCover),
+    FIELD("dew_point",FIELD_FIXED,PAST,dewPoint),
+    FIELD("dt",FIELD_LONG,PAST,dayTime),
+    FIELD("feels_like",FIELD_FIXED,PAST,apparentTemperature),
+    FIELD("humidity",FIELD_WHOLE,PAST,humidity),
+    FIELD("pressure",FIELD_WHOLE,PAST,pressure),
+    NESTED("rain",FIELD_OBJECT,timemachine_rain),
+    NESTED("snow",FIELD_OBJECT,timemachine_snow),
+    FIELD("sunrise",FIELD_LONG,PAST,sunrise),
+    FIELD("sunset",FIELD_LONG,PAST,sunset),
+    FIELD("temp",FIELD_FIXED,PAST,temperature),
+    FIELD("uvi",FIELD_SMALL,PAST,uvIndex),
+    FIELD("visibility",FIELD_WHOLE,PAST,visibility),
+    NESTED("weather",FIELD_FIRST,timemachine_weather),
+    FIELD("wind_deg",FIELD_WHOLE,PAST,windBearing),
+    FIELD("wind_gust",FIELD_SMALL,PAST,windGust),
+    FIELD("wind_speed",FIELD_SMALL,PAST,windSpeed)
+};
+FIELD_TABLE(map_timemachine,timemachine_fields);
+
+// day_summary aggregation
+constexpr FieldMap summary_afternoon_clouds_fields[] =
+{
+    FIELD("afternoon",FIELD_WHOLE,PAST,h12_cloudCover)
+};
+FIELD_TABLE(summary_afternoon_clouds,summary_afternoon_clouds_fields);
+
+constexpr FieldMap summary_afternoon_humidity_fields[] =
+{
+    FIELD("afternoon",FIELD_WHOLE,PAST,h12_humidity)
+};
+FIELD_TABLE(summary_afternoon_humidity,summary_afternoon_humidity_fields);
+
+constexpr FieldMap summary_afternoon_pressure_fields[] =
+{
+    FIELD("afternoon",FIELD_WHOLE,PAST,h12_pressure)
+};
+FIELD_TABLE(summary_afternoon_pressure,summary_afternoon_pressure_fields);
+
+constexpr FieldMap summary_precipitation_fields[] =
+{
+    FIELD("total",FIELD_FIXED,PAST,day_rainVolume) // always mm
+};
+FIELD_TABLE(summary_precipitation,summary_precipitation_fields);
+
+constexpr FieldMap summary_temperature_fields[] =
+{
+    FIELD("afternoon",FIELD_FIXED,PAST,h12_temperature),
+    FIELD("evening",FIELD_FIXED,PAST,h18_temperature),
+    FIELD("max",FIELD_FIXED,PAST,max_temperature),
+    FIELD("min",FIELD_FIXED,PAST,min_temperature),
+    FIELD("morning",FIELD_FIXED,PAST,h06_temperature),
+    FIELD("night",FIELD_FIXED,PAST,h00_temperature)
+};
+FIELD_TABLE(summary_temperature,summary_temperature_fields);
+
+constexpr FieldMap summary_wind_max_fields[] =
+{
+    FIELD("direction",FIELD_WHOLE,PAST,max_windBearing),
+    FIELD("speed",FIELD_SMALL,PAST,max_windSpeed)
+};
+FIELD_TABLE(summary_wind_max,summary_wind_max_fields);
+
+constexpr FieldMap summary_wind_fields[] =
+{
+    NESTED("max",FIELD_OBJECT,summary_wind_max)
+};
+FIELD_TABLE(summary_wind,summary_wind_fields);
+
+constexpr FieldMap day_summary_fields[] =
+{
+    NESTED("cloud_cover",FIELD_OBJECT,summary_afternoon_clouds),
+    NESTED("humidity",FIELD_OBJECT,summary_afternoon_humidity),
+    NESTED("precipitation",FIELD_OBJECT,summary_precipitation),
+    NESTED("pressure",FIELD_OBJECT,summary_afternoon_pressure),
+    NESTED("temperature",FIELD_OBJECT,summary_temperature),
+    NESTED("wind",FIELD_OBJECT,summary_wind)
+};
+FIELD_TABLE(map_day_summary,day_summary_fields);
+
+// air_pollution "list":[{...}]
+constexpr FieldMap air_components_fields[] =
+{
+    FIELD("co",FIELD_FLOAT,AIR,co),
+    FIELD("nh3",FIELD_FLOAT,AIR,nh3),
+    FIELD("no",FIELD_FLOAT,AIR,no),
+    FIELD("no2",FIELD_FLOAT,AIR,no2),
+    FIELD("o3",FIELD_FLOAT,AIR,o3),
+    FIELD("pm10",FIELD_FLOAT,AIR,pm10),
+    FIELD("pm2_5",FIELD_FLOAT,AIR,pm2_5),
+    FIELD("so2",FIELD_FLOAT,AIR,so2)
+};
+FIELD_TABLE(air_components,air_components_fields);
+
+constexpr FieldMap air_main_fields[] =
+{
+    FIELD("aqi",FIELD_INT,AIR,aqi)
+};
+FIELD_TABLE(air_main,air_main_fields);
+
+constexpr FieldMap air_quality_fields[] =
+{
+    NESTED("components",FIELD_OBJECT,air_components),
+    FIELD("dt",FIELD_LONG,AIR,dayTime),
+    NESTED("main",FIELD_OBJECT,air_main)
+};
+FIELD_TABLE(map_air_quality,air_quality_fields);
+
+
+static const FieldMap *findField(const FieldTable &table, const char *key)
+{
+    int low = 0;
+    int high = table.count - 1;
+
+    while(low <= high)
+        {
+            int middle = (low + high) / 2;
+            int order = strcmp(key, table.fields[middle].key);
+            if(order == 0) return &table.fields[middle];
+            if(order < 0) high = middle - 1;
+            else low = middle + 1;
+        }
+    return NULL;
+}
+
+static void storeNumber(const FieldMap &field, char *dest, float value, long whole, int units)
+{
+#ifdef OWOC_FIXED_POINT
+    (void)units; // FIELD_VOLUME is converted by storeFixed()
+#endif
+    switch(field.type)
+        {
+        case FIELD_LONG:
+            *(long *)dest = whole;
+            break;
+        case FIELD_INT:
+            *(int *)dest = (int)whole;
+            break;
+#ifndef OWOC_FIXED_POINT
+        case FIELD_VOLUME:
+            if(units == IMPERIAL) value /= 25.4; // mm to inch
+            // fall through
+        case FIELD_WHOLE:
+        case FIELD_SMALL:
+        case FIELD_FIXED:
+#endif
+        case FIELD_FLOAT:
+            *(float *)dest = value;
+            break;
+        }
+}
+
+#ifdef OWOC_FIXED_POINT
+// Scaled integer fields, value is in 1/FIXED_SCALE except for FIELD_WHOLE
+static bool isFixed(uint8_t type)
+{
+    return (type == FIELD_WHOLE) || (type == FIELD_SMALL) || (type == FIELD_FIXED) || (type == FIELD_VOLUME);
+}
+
+static int fixedDecimals(uint8_t type)
+{
+    return (type == FIELD_WHOLE) ? 0 : FIXED_DECIMALS;
+}
+
+static int16_t saturate16(long value)
+{
+    return (value > INT16_MAX) ? INT16_MAX : (value < INT16_MIN) ? INT16_MIN : (int16_t)value;
+}
+
+static void storeFixed(const FieldMap &field, char *dest, long value, int units)
+{
+    switch(field.type)
+        {
+        case FIELD_WHOLE:
+            *(weather_whole_t *)dest = saturate16(value);
+            break;
+        case FIELD_SMALL:
+            *(weather_small_t *)dest = saturate16(value);
+            break;
+        case FIELD_VOLUME:
+            if(units == IMPERIAL) value = (value * 5 + ((value < 0) ? -63 : 63)) / 127; // mm to inch, 10 / 254 rounded
+            // fall through
+        case FIELD_FIXED:
+            *(weather_fixed_t *)dest = value;
+            break;
+        }
+}
+
+// ArduinoJson keeps integers exact, only values with a fraction go through float
+static long variantFixed(JsonVariant value, int decimals)
+{
+    long scale = decimals ? FIXED_SCALE : 1;
+    if(value.is<long>()) return value.as<long>() * scale;
+    float scaled = value.as<float>() * scale;
+    return (long)(scaled + ((scaled < 0) ? -0.5f : 0.5f));
+}
+#endif
+
+// Each number is converted only to what its field stores
+static void storeToken(const FieldMap &field, char *dest, const JsonStreamReader &json, int units)
+{
+#ifdef OWOC_FIXED_POINT
+    if(isFixed(field.type)) return storeFixed(field, dest, json.toFixed(fixedDecimals(field.type)), units);
+#endif
+    if((field.type == FIELD_LONG) || (field.type == FIELD_INT)) storeNumber(field, dest, 0, json.toLong(), units);
+    else storeNumber(field, dest, json.toFloat(), 0, units);
+}
+
+static void storeVariant(const FieldMap &field, char *dest, JsonVariant value, int units)
+{
+#ifdef OWOC_FIXED_POINT
+    if(isFixed(field.type)) return storeFixed(field, dest, variantFixed(value, fixedDecimals(field.type)), units);
+#endif
+    if((field.type == FIELD_LONG) || (field.type == FIELD_INT)) storeNumber(field, dest, 0, value.as<long>(), units);
+    else storeNumber(field, dest, value.as<float>(), 0, units);
+}
+
+static void storeZero(const FieldMap &field, char *dest)
+{
+#ifdef OWOC_FIXED_POINT
+    if(isFixed(field.type)) return storeFixed(field, dest, 0, 0);
+#endif
+    storeNumber(field, dest, 0, 0, 0);
+}
+
+static int storeText(const FieldMap &field, void *base, const char *text, size_t length, const FillOptions &fill)
+{
+    char *dest = (char *)(field.cold ? fill.cold : base) + field.offset;
+
+    if(field.type == FIELD_ICON) return storeIconText(*(char **)dest, text, length, fill.arena);
+
+    if((field.type == FIELD_MAIN) || (field.type == FIELD_DESCRIPTION))
+        {
+            weather_whole_t id = *(weather_whole_t *)((char *)base + field.nested->fields[0].offset);
+            return storeConditionText(*(char **)dest, (int)id, text, length, field.type == FIELD_DESCRIPTION, fill.arena);
+        }
+
+    char *&string = *(char **)dest;
+    if(fill.arena)
+        {
+            string = fill.arena->copyText(text, length);
+        }
+    else
+        {
+            string = (char *)realloc(string, sizeof(char) * length + 1);
+            if(string) memcpy(string, text, length + 1);
+        }
+    return (string == NULL) ? 23 : 0;
+}
+
+void clearFields(const FieldTable &table, void *base)
+{
+    for(int f = 0; f < table.count; f++)
+        {
+            const FieldMap &field = table.fields[f];
+            if((field.type == FIELD_OBJECT) || (field.type == FIELD_FIRST))
+                clearFields(*field.nested, base);
+            else if((field.type != FIELD_STRING) && (field.type != FIELD_ICON) && (field.type != FIELD_MAIN) && (field.type != FIELD_DESCRIPTION))
+                storeZero(field, (char *)base + field.offset);
+        }
+}
+
+// Entry x of an array, its recordText when the text is split off
+static FillOptions entryOptions(const FillOptions &fill, int x)
+{
+    FillOptions entry = fill;
+    if(fill.cold) entry.cold = (char *)fill.cold + x * fill.coldSize;
+    return entry;
+}
+
+// JsonDocument
+
+int fillFields(const FieldTable &table, void *base, JsonObject object, const FillOptions &fill)
+{
+    for(JsonPair member : object)
+        {
+            const FieldMap *field = findField(table, member.key().c_str());
+            if(field == NULL) continue;
+
+            JsonVariant value = member.value();
+            char *dest = (char *)base + field->offset;
+            int error_code = 0;
+
+            switch(field->type)
+                {
+                case FIELD_OBJECT:
+                    error_code = fillFields(*field->nested, base, value.as<JsonObject>(), fill);
+                    break;
+                case FIELD_FIRST:
+                    error_code = fillFields(*field->nested, base, value[0].as<JsonObject>(), fill);
+                    break;
+                case FIELD_STRING:
+                case FIELD_ICON:
+                case FIELD_MAIN:
+                case FIELD_DESCRIPTION:
+                    if(value.is<const char*>())
+                        {
+                            const char *text = value.as<const char*>();
+                            error_code = storeText(*field, base, text, strlen(text), fill);
+                        }
+                    break;
+                default:
+                    storeVariant(*field, dest, value, fill.units);
+                }
+            if(error_code) return error_code;
+        }
+    return 0;
+}
+
+int fillArray(const FieldTable &table, void *base, size_t size, int count, JsonArray array, const FillOptions &fill)
+{
+    for(int x = 0; x < count; x++)
+        {
+            void *entry = (char *)base + x * size;
+            clearFields(table, entry);
+            int error_code = fillFields(table, entry, array[x].as<JsonObject>(), entryOptions(fill, x));
+            if(error_code) return error_code;
+        }
+    return 0;
+}
+
+// JsonStreamReader
+
+// Members of an object whose JSON_OBJECT token was just read
+int streamMembers(const FieldTable &table, void *base, JsonStreamReader &json, const FillOptions &fill)
+{
+    int token;
+    while((token = json.next()) == JSON_KEY)
+        {
+            const FieldMap *field = findField(table, json.text());
+            if(field == NULL)
+                {
+                    if(!json.skipValue()) return json.outOfMemory() ? 23 : 25;
+                    continue;
+                }
+
+            char *dest = (char *)base + field->offset;
+            int error_code = 0;
+
+            token = json.next();
+            if(token == JSON_ERROR) return json.outOfMemory() ? 23 : 25;
+
+            switch(field->type)
+                {
+                case FIELD_OBJECT:
+                    if(token == JSON_OBJECT) error_code = streamMembers(*field->nested, base, json, fill);
+                    else if(token == JSON_ARRAY) error_code = json.skipContainer() ? 0 : 25;
+                    break;
+                case FIELD_FIRST:
+                    if(token == JSON_OBJECT)
+                        {
+                            error_code = json.skipContainer() ? 0 : 25;
+                            break;
+                        }
+                    if(token != JSON_ARRAY) break;
+                    token = json.next();
+                    if(token == JSON_OBJECT) error_code = streamMembers(*field->nested, base, json, fill);
+                    else if(token == JSON_ARRAY) error_code = json.skipContainer() ? 0 : 25;
+                    if((token == JSON_ARRAY_END) || error_code) break;
+                    // Only the first element is used
+                    error_code = json.skipContainer() ? 0 : 25;
+                    break;
+                case FIELD_STRING:
+                case FIELD_ICON:
+                case FIELD_MAIN:
+                case FIELD_DESCRIPTION:
+                    if(token == JSON_STRING) error_code = storeText(*field, base, json.text(), json.length(), fill);
+                    else if((token == JSON_OBJECT) || (token == JSON_ARRAY)) error_code = json.skipContainer() ? 0 : 25;
+                    break;
+                default:
+                    if(token == JSON_NUMBER) storeToken(*field, dest, json, fill.units);
+                    else if((token == JSON_OBJECT) || (token == JSON_ARRAY)) error_code = json.skipContainer() ? 0 : 25;
+                    else storeZero(*field, dest);
+                }
+            if(error_code) return json.outOfMemory() ? 23 : error_code;
+        }
+
+    if(token != JSON_OBJECT_END) return json.outOfMemory() ? 23 : 25;
+    return 0;
+}
+
+int streamFields(const FieldTable &table, void *base, JsonStreamReader &json, const FillOptions &fill)
+{
+    int token = json.next();
+    if(token == JSON_OBJECT) return streamMembers(table, base, json, fill);
+    if(token == JSON_ARRAY) return json.skipContainer() ? 0 : 25;
+    if(token == JSON_ERROR) return json.outOfMemory() ? 23 : 25;
+    return 0; // null
+}
+
+int streamArray(const FieldTable &table, void *base, size_t size, int count, JsonStreamReader &json, const FillOptions &fill)
+{
+    int x = 0;
+    int token = json.next();
+
+    if(token == JSON_ARRAY)
+        {
+            while((token = json.next()) != JSON_ARRAY_END)
+                {
+                    if((token == JSON_ERROR) || (token == JSON_END)) return json.outOfMemory() ? 23 : 25;
+                    if(x >= count)
+                        {
+                            if(((token == JSON_OBJECT) || (token == JSON_ARRAY)) && !json.skipContainer()) return 25;
+                            continue;
+                        }
+
+                    FillOptions options = entryOptions(fill, x);
+                    void *entry = (char *)base + x++ * size;
+                    clearFields(table, entry);
+                    if(token == JSON_OBJECT)
+                        {
+                            int error_code = streamMembers(table, entry, json, options);
+                            if(error_code) return error_code;
+                        }
+                    else if((token == JSON_ARRAY) && !json.skipContainer()) return 25;
+                }
+        }
+    else if(token == JSON_OBJECT)
+        {
+            if(!json.skipContainer()) return 25;
+        }
+    else if(token == JSON_ERROR) return json.outOfMemory() ? 23 : 25;
+
+    // Entries the array did not reach read as zero, like the JsonDocument path
+    for(; x < count; x++)
+        {
+            clearFields(table, (char *)base + x * size);
+        }
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+   FieldMap.h
+   Descriptor tables: JSON key -> offset, type and unit rule in one of
+   the result structs. One generic routine fills a struct from a JSON
+   object in a single pass over its members, either from a JsonObject
+   or straight from a JsonStreamReader.
+
+   Tables are sorted by key (checked at compile time in FieldMap.cpp),
+   every member is looked up with a binary search.
+*/
+
+#ifndef _FIELD_MAP_H
+#define _FIELD_MAP_H
+
+#include "OpenWeatherOneCall.h"
+#include "JsonStreamReader.h"
+#include "OpenWeatherArena.h"
+
+//FIELD TYPES
+#define FIELD_LONG 1
+#define FIELD_INT 2
+#define FIELD_FLOAT 3
+#define FIELD_VOLUME 4 // float, mm converted to inch for IMPERIAL
+#define FIELD_STRING 5 // char*, reallocated to fit
+#define FIELD_ICON 6   // char*, icon table entry
+#define FIELD_OBJECT 7 // nested object, members in nested
+#define FIELD_FIRST 8  // array, members of its first object in nested
+#define FIELD_MAIN 9         // char*, condition table text, nested holds the id field
+#define FIELD_DESCRIPTION 10 // as FIELD_MAIN
+#define FIELD_WHOLE 11 // weather_whole_t, whole number in the payload
+#define FIELD_SMALL 12 // weather_small_t
+#define FIELD_FIXED 13 // weather_fixed_t
+// FIELD_VOLUME is a weather_fixed_t as well, see OWOC_FIXED_POINT
+
+struct FieldTable;
+
+struct FieldMap
+{
+    const char *key;
+    uint8_t type;
+    uint8_t cold;    // OWOC_SPLIT_RECORDS: offset is into FillOptions::cold
+    uint16_t offset; // from the start of the struct being filled
+    const FieldTable *nested;
+};
+
+struct FieldTable
+{
+    const FieldMap *fields;
+    uint8_t count;
+};
+
+// Settings of one parse
+struct FillOptions
+{
+    int units;
+    OpenWeatherArena *arena; // NULL: strings on the heap
+    void *cold;              // recordText of the entry, or of an array of coldSize entries
+    size_t coldSize;
+};
+
+// One Call
+extern const FieldTable map_current;
+extern const FieldTable map_daily;
+extern const FieldTable map_hourly;
+extern const FieldTable map_minutely;
+extern const FieldTable map_alerts;
+
+// History and air quality
+extern const FieldTable map_timemachine;
+extern const FieldTable map_day_summary;
+extern const FieldTable map_air_quality;
+
+// Zero every number the table maps, strings and icons are kept
+void clearFields(const FieldTable &table, void *base);
+
+// Fill from a JsonDocument object, members not in the table are ignored
+int fillFields(const FieldTable &table, void *base, JsonObject object, const FillOptions &fill);
+int fillArray(const FieldTable &table, void *base, size_t size, int count, JsonArray array, const FillOptions &fill);
+
+// Fill from the next value of the stream, an object (or null)
+int streamFields(const FieldTable &table, void *base, JsonStreamReader &json, const FillOptions &fill);
+int streamMembers(const FieldTable &table, void *base, JsonStreamReader &json, const FillOptions &fill); // after JSON_OBJECT
+int streamArray(const FieldTable &table, void *base, size_t size, int count, JsonStreamReader &json, const FillOptions &fill);
+
+#endif
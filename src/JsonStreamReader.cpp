@@ -0,0 +1,303 @@
+/*
+   JsonStreamReader.cpp
+   Pull tokenizer, see JsonStreamReader.h
+*/
+
+#include "JsonStreamReader.h"
+#include <limits.h>
+
+JsonStreamReader::JsonStreamReader(Stream &stream) :
+    _stream(stream), _text(NULL), _len(0), _cap(0), _pushback(-1), _objects(0),
+    _depth(0), _expectKey(false), _done(false), _noMemory(false)
+{
+    _text = (char *)malloc(32);
+    if(_text == NULL)
+        {
+            _noMemory = true;
+            return;
+        }
+    _cap = 32;
+    _text[0] = '\0';
+}
+
+JsonStreamReader::~JsonStreamReader()
+{
+    if(_text) free(_text);
+}
+
+int JsonStreamReader::next(void)
+{
+    return JsonStreamReader::readToken(true);
+}
+
+bool JsonStreamReader::skipValue(void)
+{
+    int token = JsonStreamReader::readToken(false);
+    if((token == JSON_OBJECT) || (token == JSON_ARRAY))
+        {
+            return JsonStreamReader::skipContainer();
+        }
+    return (token == JSON_STRING) || (token == JSON_NUMBER) || (token == JSON_LITERAL);
+}
+
+bool JsonStreamReader::skipContainer(void)
+{
+    int target = _depth - 1;
+    while(_depth > target)
+        {
+            int token = JsonStreamReader::readToken(false);
+            if((token == JSON_ERROR) || (token == JSON_END)) return false;
+        }
+    return true;
+}
+
+long JsonStreamReader::toLong(void) const
+{
+    return strtol(_text, NULL, 10);
+}
+
+float JsonStreamReader::toFloat(void) const
+{
+    return strtof(_text, NULL);
+}
+
+long JsonStreamReader::toFixed(int decimals) const
+{
+    const char *p = _text;
+    bool negative = (*p == '-');
+    if(negative) p++;
+
+    // Digits that fit, the decimal exponent moves for the rest
+    long value = 0;
+    int exponent = decimals;
+    bool fraction = false;
+    for(; *p; p++)
+        {
+            if(*p == '.') fraction = true;
+            else if((*p >= '0') && (*p <= '9'))
+                {
+                    if(value < LONG_MAX / 10 - 9)
+                        {
+                            value = value * 10 + (*p - '0');
+                            if(fraction) exponent--;
+                        }
+                    else if(!fraction) exponent++;
+                }
+            else break;
+        }
+    if((*p == 'e') || (*p == 'E')) exponent += strtol(p + 1, NULL, 10);
+
+    for(; (exponent > 0) && (value <= LONG_MAX / 10); exponent--) value *= 10;
+    if(exponent > 0) value = LONG_MAX;
+    for(; (exponent < -1) && value; exponent++) value /= 10;
+    if(exponent == -1) value = (value + 5) / 10; // half away from zero
+    return negative ? -value : value;
+}
+
+bool JsonStreamReader::isNull(void) const
+{
+    return (_len == 4) && !strcmp(_text, "null");
+}
+
+int JsonStreamReader::read(void)
+{
+    if(_pushback >= 0)
+        {
+            int c = _pushback;
+            _pushback = -1;
+            return c;
+        }
+    char c;
+    if(_stream.readBytes(&c, 1) != 1) return -1;
+    return (unsigned char)c;
+}
+
+int JsonStreamReader::readToken(bool keep)
+{
+    if(_done) return JSON_END;
+    if(_noMemory) return JSON_ERROR;
+
+    int c;
+    while(true)
+        {
+            c = JsonStreamReader::read();
+            if((c == ' ') || (c == '\n') || (c == '\r') || (c == '\t') || (c == ':')) continue;
+            if(c == ',')
+                {
+                    _expectKey = (_depth > 0) && (_objects & (1UL << (_depth - 1)));
+                    continue;
+                }
+            break;
+        }
+
+    _len = 0;
+    _text[0] = '\0';
+
+    switch(c)
+        {
+        case -1:
+            return JSON_ERROR;
+
+        case '{':
+        case '[':
+            if(_depth >= JSON_MAX_DEPTH) return JSON_ERROR;
+            if(c == '{') _objects |= (1UL << _depth);
+            else _objects &= ~(1UL << _depth);
+            _depth++;
+            _expectKey = (c == '{');
+            return (c == '{') ? JSON_OBJECT : JSON_ARRAY;
+
+        case '}':
+        case ']':
+            if(_depth == 0) return JSON_ERROR;
+            _depth--;
+            _expectKey = false;
+            if(_depth == 0) _done = true;
+            return (c == '}') ? JSON_OBJECT_END : JSON_ARRAY_END;
+
+        case '"':
+            {
+                bool key = _expectKey;
+                _expectKey = false;
+                if(JsonStreamReader::readString(keep)) return JSON_ERROR;
+                if(_depth == 0) _done = true;
+                return key ? JSON_KEY : JSON_STRING;
+            }
+
+        default:
+            {
+                int token = JsonStreamReader::readScalar(c, keep);
+                if((token != JSON_ERROR) && (_depth == 0)) _done = true;
+                return token;
+            }
+        }
+}
+
+int JsonStreamReader::readString(bool keep)
+{
+    while(true)
+        {
+            int c = JsonStreamReader::read();
+            if(c < 0) return -1;
+            if(c == '"') return 0;
+
+            if(c != '\\')
+                {
+                    if(!JsonStreamReader::append((char)c, keep)) return -1;
+                    continue;
+                }
+
+            c = JsonStreamReader::read();
+            switch(c)
+                {
+                case 'b':
+                    c = '\b';
+                    break;
+                case 'f':
+                    c = '\f';
+                    break;
+                case 'n':
+                    c = '\n';
+                    break;
+                case 'r':
+                    c = '\r';
+                    break;
+                case 't':
+                    c = '\t';
+                    break;
+                case 'u':
+                    {
+                        unsigned long codePoint;
+                        if(!JsonStreamReader::readHex4(codePoint)) return -1;
+                        if((codePoint >= 0xD800) && (codePoint <= 0xDBFF))
+                            {
+                                // High surrogate, the low half follows as a second escape
+                                unsigned long low;
+                                if(JsonStreamReader::read() != '\\') return -1;
+                                if(JsonStreamReader::read() != 'u') return -1;
+                                if(!JsonStreamReader::readHex4(low)) return -1;
+                                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                            }
+                        if(!JsonStreamReader::appendUTF8(codePoint, keep)) return -1;
+                        continue;
+                    }
+                case -1:
+                    return -1;
+                default:
+                    break; // \" \\ \/
+                }
+            if(!JsonStreamReader::append((char)c, keep)) return -1;
+        }
+}
+
+int JsonStreamReader::readScalar(int c, bool keep)
+{
+    int token = ((c == '-') || ((c >= '0') && (c <= '9'))) ? JSON_NUMBER : JSON_LITERAL;
+
+    while((c >= 0) && (c != ',') && (c != '}') && (c != ']') && (c != ' ') && (c != '\n') && (c != '\r') && (c != '\t'))
+        {
+            if(!JsonStreamReader::append((char)c, keep)) return JSON_ERROR;
+            c = JsonStreamReader::read();
+        }
+    _pushback = c;
+
+    return token;
+}
+
+bool JsonStreamReader::append(char c, bool keep)
+{
+    if(!keep) return true;
+
+    if(_len + 2 > _cap)
+        {
+            char *grown = (char *)realloc(_text, _cap * 2);
+            if(grown == NULL)
+                {
+                    _noMemory = true;
+                    return false;
+                }
+            _text = grown;
+            _cap *= 2;
+        }
+    _text[_len++] = c;
+    _text[_len] = '\0';
+    return true;
+}
+
+bool JsonStreamReader::readHex4(unsigned long &value)
+{
+    value = 0;
+    for(int h = 0; h < 4; h++)
+        {
+            int d = JsonStreamReader::read();
+            value <<= 4;
+            if((d >= '0') && (d <= '9')) value |= d - '0';
+            else if((d >= 'a') && (d <= 'f')) value |= d - 'a' + 10;
+            else if((d >= 'A') && (d <= 'F')) value |= d - 'A' + 10;
+            else return false;
+        }
+    return true;
+}
+
+bool JsonStreamReader::appendUTF8(unsigned long codePoint, bool keep)
+{
+    if(codePoint < 0x80)
+        {
+            return JsonStreamReader::append((char)codePoint, keep);
+        }
+    if(codePoint < 0x800)
+        {
+            return JsonStreamReader::append((char)(0xC0 | (codePoint >> 6)), keep) &&
+                   JsonStreamReader::append((char)(0x80 | (codePoint & 0x3F)), keep);
+        }
+    if(codePoint < 0x10000)
+        {
+            return JsonStreamReader::append((char)(0xE0 | (codePoint >> 12)), keep) &&
+                   JsonStreamReader::append((char)(0x80 | ((codePoint >> 6) & 0x3F)), keep) &&
+                   JsonStreamReader::append((char)(0x80 | (codePoint & 0x3F)), keep);
+        }
+    return JsonStreamReader::append((char)(0xF0 | (codePoint >> 18)), keep) &&
+           JsonStreamReader::append((char)(0x80 | ((codePoint >> 12) & 0x3F)), keep) &&
+           JsonStreamReader::append((char)(0x80 | ((codePoint >> 6) & 0x3F)), keep) &&
+           JsonStreamReader::append((char)(0x80 | (codePoint & 0x3F)), keep);
+}
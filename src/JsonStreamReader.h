@@ -0,0 +1,89 @@
+/*
+   JsonStreamReader.h
+   Pull tokenizer for JSON read straight from a Stream, no document is
+   built. Memory use is one text buffer the size of the longest key or
+   string value that is kept.
+
+   Reading stops at the end of the root value, nothing after it is
+   consumed from the stream.
+*/
+
+#ifndef _JSON_STREAM_READER_H
+#define _JSON_STREAM_READER_H
+
+#include <Arduino.h>
+
+//TOKENS
+#define JSON_ERROR -1
+#define JSON_END 0
+#define JSON_OBJECT 1
+#define JSON_OBJECT_END 2
+#define JSON_ARRAY 3
+#define JSON_ARRAY_END 4
+#define JSON_KEY 5
+#define JSON_STRING 6
+#define JSON_NUMBER 7
+#define JSON_LITERAL 8 // true, false or null
+
+#define JSON_MAX_DEPTH 32
+
+class JsonStreamReader
+{
+public:
+    JsonStreamReader(Stream &stream);
+    ~JsonStreamReader();
+
+    // Next token, JSON_END after the root value closed
+    int next(void);
+
+    // Discard the next value (after a JSON_KEY, or an array element)
+    bool skipValue(void);
+
+    // Discard the rest of the container just opened by JSON_OBJECT/JSON_ARRAY
+    bool skipContainer(void);
+
+    // Text of the last JSON_KEY, JSON_STRING, JSON_NUMBER or JSON_LITERAL
+    const char* text(void) const
+    {
+        return _text;
+    }
+    size_t length(void) const
+    {
+        return _len;
+    }
+    long toLong(void) const;
+    float toFloat(void) const;
+    long toFixed(int decimals) const; // value * 10^decimals, rounded, no floating point
+    bool isNull(void) const;
+
+    int depth(void) const
+    {
+        return _depth;
+    }
+    bool outOfMemory(void) const
+    {
+        return _noMemory;
+    }
+
+private:
+    int read(void);
+    int readToken(bool keep);
+    int readString(bool keep);
+    int readScalar(int c, bool keep);
+    bool append(char c, bool keep);
+    bool appendUTF8(unsigned long codePoint, bool keep);
+    bool readHex4(unsigned long &value);
+
+    Stream &_stream;
+    char *_text;
+    size_t _len;
+    size_t _cap;
+    int _pushback;
+    uint32_t _objects;  // bit per depth, set for objects
+    int _depth;
+    bool _expectKey;
+    bool _done;
+    bool _noMemory;
+};
+
+#endif
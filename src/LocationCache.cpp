@@ -0,0 +1,92 @@
+/*
+   LocationCache.cpp
+   Reverse geocode cache, see LocationCache.h
+*/
+
+#include "LocationCache.h"
+#include <math.h>
+
+LocationCache::LocationCache()
+{
+    memset(&_store,0,sizeof(_store));
+    _store.magic = LOCATION_CACHE_MAGIC;
+    _store.precision = LOCATION_PRECISION;
+}
+
+int LocationCache::setPrecision(int decimals)
+{
+    if((decimals < 0) || (decimals > LOCATION_MAX_PRECISION)) return 30;
+    if(decimals != _store.precision) LocationCache::clear();
+    _store.precision = decimals;
+    return 0;
+}
+
+void LocationCache::clear(void)
+{
+    memset(_store.entries,0,sizeof(_store.entries));
+    _store.useCount = 0;
+}
+
+int32_t LocationCache::roundCoordinate(float coordinate) const
+{
+    static const int32_t scale[LOCATION_MAX_PRECISION + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+    return (int32_t)lround((double)coordinate * scale[_store.precision]);
+}
+
+const LocationEntry *LocationCache::find(float latitude, float longitude)
+{
+    int32_t lat = LocationCache::roundCoordinate(latitude);
+    int32_t lon = LocationCache::roundCoordinate(longitude);
+
+    for(int x = 0; x < LOCATION_CACHE_SIZE; x++)
+        {
+            LocationEntry &entry = _store.entries[x];
+            if(entry.lastUse && (entry.latitude == lat) && (entry.longitude == lon))
+                {
+                    entry.lastUse = ++_store.useCount;
+                    return &entry;
+                }
+        }
+    return NULL;
+}
+
+void LocationCache::store(float latitude, float longitude, const char *city, const char *state, const char *country)
+{
+    int32_t lat = LocationCache::roundCoordinate(latitude);
+    int32_t lon = LocationCache::roundCoordinate(longitude);
+
+    // The same place, else a free entry, else the least recently used one
+    LocationEntry *slot = &_store.entries[0];
+    for(int x = 0; x < LOCATION_CACHE_SIZE; x++)
+        {
+            LocationEntry &entry = _store.entries[x];
+            if(entry.lastUse && (entry.latitude == lat) && (entry.longitude == lon))
+                {
+                    slot = &entry;
+                    break;
+                }
+            if(entry.lastUse < slot->lastUse) slot = &entry;
+        }
+
+    slot->latitude = lat;
+    slot->longitude = lon;
+    slot->lastUse = ++_store.useCount;
+    strncpy(slot->CITY,city,sizeof(slot->CITY) - 1);
+    slot->CITY[sizeof(slot->CITY) - 1] = '\0';
+    strncpy(slot->STATE,state,sizeof(slot->STATE) - 1);
+    slot->STATE[sizeof(slot->STATE) - 1] = '\0';
+    strncpy(slot->COUNTRY,country,sizeof(slot->COUNTRY) - 1);
+    slot->COUNTRY[sizeof(slot->COUNTRY) - 1] = '\0';
+}
+
+bool LocationCache::restore(const void *blob, size_t length)
+{
+    if((blob == NULL) || (length != sizeof(_store))) return false;
+    uint16_t magic;
+    memcpy(&magic,blob,sizeof(magic)); // blob may not be aligned
+    if(magic != LOCATION_CACHE_MAGIC) return false;
+
+    memcpy(&_store,blob,sizeof(_store));
+    if(_store.precision > LOCATION_MAX_PRECISION) LocationCache::setPrecision(LOCATION_PRECISION);
+    return true;
+}
@@ -0,0 +1,72 @@
+/*
+   LocationCache.h
+   Reverse geocode results (city, state, country) keyed by coordinates
+   rounded to a number of decimals, 2 by default (about 1 km). The
+   least recently used place makes room when all entries are taken.
+
+   Every OpenWeatherOneCall has its own cache; one cache can be shared
+   by several instances with setLocationCache() when they are used
+   from one task. data()/size() and restore() let the application keep
+   the cache in NVS, RTC memory or a file across restarts.
+*/
+
+#ifndef _LOCATION_CACHE_H
+#define _LOCATION_CACHE_H
+
+#include <Arduino.h>
+
+#define LOCATION_CACHE_SIZE 8
+#define LOCATION_PRECISION 2     // Decimals of the rounded coordinates
+#define LOCATION_MAX_PRECISION 6
+#define LOCATION_CACHE_MAGIC 0x4C43 // "LC", changes when the layout does
+
+struct LocationEntry
+{
+    int32_t latitude;  // Rounded, times 10^precision
+    int32_t longitude;
+    uint32_t lastUse;  // 0: free
+    char CITY[60];
+    char STATE[10];
+    char COUNTRY[10];
+};
+
+class LocationCache
+{
+public:
+    LocationCache();
+
+    int setPrecision(int decimals); // Clears the cache, 30 when out of range
+    int getPrecision(void) const
+    {
+        return _store.precision;
+    }
+    void clear(void);
+
+    // NULL when the place has not been looked up yet
+    const LocationEntry *find(float latitude, float longitude);
+    void store(float latitude, float longitude, const char *city, const char *state, const char *country);
+
+    // Persistence, restore() returns false for a blob it can't use
+    const void *data(void) const
+    {
+        return &_store;
+    }
+    size_t size(void) const
+    {
+        return sizeof(_store);
+    }
+    bool restore(const void *blob, size_t length);
+
+private:
+    int32_t roundCoordinate(float coordinate) const;
+
+    struct
+    {
+        uint16_t magic;
+        uint8_t precision;
+        uint32_t useCount;
+        LocationEntry entries[LOCATION_CACHE_SIZE];
+    } _store;
+};
+
+#endif
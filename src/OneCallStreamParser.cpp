@@ -0,0 +1,150 @@
+/*
+   OneCallStreamParser.cpp
+   STREAM_PARSER path of createCurrent(): the One Call body is read
+   once from the HTTP stream and every value is written straight into
+   current, forecast, hour, minute and alert. No JsonDocument is built,
+   peak memory is the result structs plus the longest string value.
+
+   Both paths fill the structs from the same tables, see FieldMap.cpp
+*/
+
+#include "OpenWeatherOneCall.h"
+#include "JsonStreamReader.h"
+#include "FieldMap.h"
+
+static bool isKey(JsonStreamReader &json, const char *key)
+{
+    return !strcmp(json.text(), key);
+}
+
+int OpenWeatherOneCall::parseOneCallStream(Stream &stream)
+{
+    int error_code = 0;
+    bool timezoneFound = false;
+    FillOptions fill = {USER_PARAM.OPEN_WEATHER_UNITS, arena.active() ? &arena : NULL, NULL, 0};
+
+    if(exclude.current) OpenWeatherOneCall::freeCurrentMem();
+    else
+        {
+            if(!current)
+                {
+                    current = (struct nowData *)OpenWeatherOneCall::allocate(1,sizeof(struct nowData));
+                    if(current == NULL) return 23;
+                }
+            clearFields(map_current,current);
+        }
+
+    FillOptions daily = fill;
+    if(exclude.daily) OpenWeatherOneCall::freeForecastMem();
+    else
+        {
+            if(OpenWeatherOneCall::allocateForecast(daily)) return 23;
+            for(int x = 0; x < NUM_DAYS; x++) clearFields(map_daily,&forecast[x]);
+        }
+
+    // Always clear because of nested allocations
+    OpenWeatherOneCall::freeAlertMem();
+    if(exclude.hourly) OpenWeatherOneCall::freeHourMem();
+    if(exclude.minutely) OpenWeatherOneCall::freeMinuteMem();
+
+    JsonStreamReader json(stream);
+    if(json.next() != JSON_OBJECT) return json.outOfMemory() ? 23 : 25;
+
+    int token;
+    while((token = json.next()) == JSON_KEY)
+        {
+            if(isKey(json,"timezone"))
+                {
+                    if(json.next() != JSON_STRING) return 25;
+                    strncpy(location.timezone,json.text(),50);
+                    timezoneFound = true;
+                }
+            else if(isKey(json,"timezone_offset"))
+                {
+                    token = json.next();
+                    location.timezoneOffset = (token == JSON_NUMBER) ? json.toLong() : 0;
+                    if((token == JSON_OBJECT) || (token == JSON_ARRAY)) error_code = json.skipContainer() ? 0 : 25;
+                    else if(token == JSON_ERROR) error_code = json.outOfMemory() ? 23 : 25;
+                }
+            else if(isKey(json,"current") && !exclude.current)
+                {
+                    error_code = streamFields(map_current,current,json,fill);
+                }
+            else if(isKey(json,"daily") && !exclude.daily)
+                {
+                    error_code = streamArray(map_daily,forecast,sizeof(struct futureData),NUM_DAYS,json,daily);
+                }
+            else if(isKey(json,"hourly") && !exclude.hourly)
+                {
+                    if(!hour)
+                        {
+                            hour = (struct HOURLY *)OpenWeatherOneCall::allocate(NUM_HOURS, sizeof(struct HOURLY));
+                            if(hour == NULL) return 23;
+                        }
+                    error_code = streamArray(map_hourly,hour,sizeof(struct HOURLY),NUM_HOURS,json,fill);
+                }
+            else if(isKey(json,"minutely") && !exclude.minutely)
+                {
+                    if(!minute)
+                        {
+                            minute = (struct MINUTELY *)OpenWeatherOneCall::allocate(NUM_MINUTES, sizeof(struct MINUTELY));
+                            if(minute == NULL) return 23;
+                        }
+                    error_code = streamArray(map_minutely,minute,sizeof(struct MINUTELY),NUM_MINUTES,json,fill);
+                }
+            else if(isKey(json,"alerts") && !exclude.alerts)
+                {
+                    error_code = OpenWeatherOneCall::streamAlerts(json);
+                }
+            else if(!json.skipValue())
+                {
+                    error_code = json.outOfMemory() ? 23 : 25;
+                }
+
+            if(error_code) return error_code;
+        }
+
+    if(token != JSON_OBJECT_END) return json.outOfMemory() ? 23 : 25;
+    if(!timezoneFound) return 23;
+
+    // Offsets are only final once the whole body is read
+    OpenWeatherOneCall::formatOneCallDates();
+    return OpenWeatherOneCall::fillSeries();
+}
+
+// Alerts grow one at a time up to alertCapacity, their strings are owned by the entry.
+// In an arena the array is taken at full size once: the strings between
+// two alerts would leave every grown copy behind.
+int OpenWeatherOneCall::streamAlerts(JsonStreamReader &json)
+{
+    if(json.next() != JSON_ARRAY) return 25;
+
+    int token;
+    while((token = json.next()) == JSON_OBJECT)
+        {
+            if(MAX_NUM_ALERTS >= alertCapacity)
+                {
+                    if(!json.skipContainer()) return 25;
+                    continue;
+                }
+
+            if(arena.active())
+                {
+                    if(!alert) alert = (struct ALERTS *)OpenWeatherOneCall::allocate(alertCapacity,sizeof(struct ALERTS));
+                    if(alert == NULL) return 23;
+                }
+            else
+                {
+                    struct ALERTS *grown = (struct ALERTS *)OpenWeatherOneCall::reallocate(alert,MAX_NUM_ALERTS * sizeof(struct ALERTS),(MAX_NUM_ALERTS + 1) * sizeof(struct ALERTS));
+                    if(grown == NULL) return 23;
+                    alert = grown;
+                }
+            memset(&alert[MAX_NUM_ALERTS],0,sizeof(struct ALERTS));
+
+            FillOptions fill = {USER_PARAM.OPEN_WEATHER_UNITS, arena.active() ? &arena : NULL, NULL, 0};
+            int error_code = streamMembers(map_alerts,&alert[MAX_NUM_ALERTS++],json,fill);
+            if(error_code) return error_code;
+        }
+
+    return (token == JSON_ARRAY_END) ? 0 : 25;
+}
@@ -0,0 +1,106 @@
+/*
+   OpenWeatherArena.cpp
+   Bump allocator, see OpenWeatherArena.h
+*/
+
+#include "OpenWeatherArena.h"
+
+OpenWeatherArena::OpenWeatherArena() :
+    _base(NULL), _size(0), _used(0), _peak(0), _last(0), _owned(false)
+{
+}
+
+OpenWeatherArena::~OpenWeatherArena()
+{
+    OpenWeatherArena::end();
+}
+
+int OpenWeatherArena::begin(void *buffer, size_t size)
+{
+    OpenWeatherArena::end();
+    if((buffer == NULL) || (size == 0)) return 0;
+
+    // Blocks are aligned from the start of the buffer
+    size_t skip = (ARENA_ALIGN - ((uintptr_t)buffer % ARENA_ALIGN)) % ARENA_ALIGN;
+    if(skip >= size) return 23;
+
+    _base = (char *)buffer + skip;
+    _size = size - skip;
+    return 0;
+}
+
+int OpenWeatherArena::begin(size_t size)
+{
+    OpenWeatherArena::end();
+    if(size == 0) return 0;
+
+    void *block = malloc(size);
+    if(block == NULL) return 23;
+
+    _base = (char *)block;
+    _size = size;
+    _owned = true;
+    return 0;
+}
+
+void OpenWeatherArena::end(void)
+{
+    if(_owned) free(_base);
+    _base = NULL;
+    _size = 0;
+    _used = 0;
+    _peak = 0;
+    _last = 0;
+    _owned = false;
+}
+
+void OpenWeatherArena::reset(void)
+{
+    _used = 0;
+    _last = 0;
+}
+
+void *OpenWeatherArena::calloc(size_t count, size_t size)
+{
+    size_t bytes = count * size;
+    size_t start = (_used + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+    if((_base == NULL) || (start > _size) || (bytes > _size - start)) return NULL;
+
+    _last = start;
+    _used = start + bytes;
+    if(_used > _peak) _peak = _used;
+
+    memset(_base + start, 0, bytes);
+    return _base + start;
+}
+
+void *OpenWeatherArena::reallocate(void *block, size_t oldSize, size_t size)
+{
+    if(block == NULL) return OpenWeatherArena::calloc(1, size);
+
+    if((char *)block == _base + _last)
+        {
+            if(size > _size - _last) return NULL;
+            if(size > oldSize) memset((char *)block + oldSize, 0, size - oldSize);
+            _used = _last + size;
+            if(_used > _peak) _peak = _used;
+            return block;
+        }
+
+    void *grown = OpenWeatherArena::calloc(1, size);
+    if(grown) memcpy(grown, block, (oldSize < size) ? oldSize : size);
+    return grown;
+}
+
+char *OpenWeatherArena::copyText(const char *text, size_t length)
+{
+    char *copy = (char *)OpenWeatherArena::calloc(1, length + 1);
+    if(copy) memcpy(copy, text, length);
+    return copy;
+}
+
+bool OpenWeatherArena::owns(const void *block) const
+{
+    return (_base != NULL) && ((const char *)block >= _base) && ((const char *)block < _base + _size);
+}
@@ -0,0 +1,62 @@
+/*
+   OpenWeatherArena.h
+   Bump allocator for the result data of one refresh. Blocks come from
+   a single buffer (the caller's or one malloc'd block) and are all
+   released at once by reset(), nothing is freed piece by piece.
+*/
+
+#ifndef _OPEN_WEATHER_ARENA_H
+#define _OPEN_WEATHER_ARENA_H
+
+#include <Arduino.h>
+
+#define ARENA_ALIGN 8
+#define ARENA_BLOCK(bytes) (((bytes) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN) // room one calloc() takes
+
+class OpenWeatherArena
+{
+public:
+    OpenWeatherArena();
+    ~OpenWeatherArena();
+
+    int begin(void *buffer, size_t size); // caller's buffer
+    int begin(size_t size);               // one internal block, 23 when it can't be allocated
+    void end(void);
+
+    bool active(void) const
+    {
+        return _base != NULL;
+    }
+    void reset(void);
+
+    // Zeroed block, NULL when the arena is full
+    void *calloc(size_t count, size_t size);
+    // Grows in place when block is the newest allocation
+    void *reallocate(void *block, size_t oldSize, size_t size);
+    char *copyText(const char *text, size_t length);
+
+    bool owns(const void *block) const;
+
+    size_t capacity(void) const
+    {
+        return _size;
+    }
+    size_t used(void) const
+    {
+        return _used;
+    }
+    size_t peak(void) const
+    {
+        return _peak;
+    }
+
+private:
+    char *_base;
+    size_t _size;
+    size_t _used;
+    size_t _peak;
+    size_t _last; // offset of the newest block
+    bool _owned;
+};
+
+#endif
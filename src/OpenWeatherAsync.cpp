@@ -0,0 +1,99 @@
+/*
+   OpenWeatherAsync.cpp
+   parseWeatherAsync(): parseWeather() on its own FreeRTOS task so the
+   caller's loop keeps running through DNS, TLS, download and parse.
+
+   The error code is passed to the callback, which runs on the refresh
+   task, and can be polled with getAsyncResult(). isRefreshing() only
+   goes false after the callback has returned.
+
+   CONCURRENT_FETCH: createConcurrent() runs the air quality request on
+   a task on the other core, with its own connection, while this task
+   does the One Call request. Both are joined before parseWeather()
+   returns. A second TLS connection is open meanwhile.
+*/
+
+#include "OpenWeatherOneCall.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+int OpenWeatherOneCall::parseWeatherAsync(std::function<void(int)> callable)
+{
+    bool idle = false;
+    if(!asyncBusy.compare_exchange_strong(idle,true)) return 28;
+
+    AsyncDoneCallback = callable;
+    asyncResult = ASYNC_RUNNING;
+
+    if(xTaskCreate(OpenWeatherOneCall::asyncTask,"OWOC refresh",ASYNC_STACK,this,ASYNC_PRIORITY,NULL) != pdPASS)
+        {
+            asyncResult = 23;
+            asyncBusy = false;
+            return 23;
+        }
+    return 0;
+}
+
+bool OpenWeatherOneCall::isRefreshing(void)
+{
+    return asyncBusy;
+}
+
+int OpenWeatherOneCall::getAsyncResult(void)
+{
+    return asyncResult;
+}
+
+void OpenWeatherOneCall::asyncTask(void *owoc)
+{
+    OpenWeatherOneCall *self = (OpenWeatherOneCall *)owoc;
+
+    // Already off the caller's task, stale results are refreshed here
+    int error_code = (self->cacheLookup() == CACHE_FRESH) ? 0 : self->fetchWeather();
+    self->asyncResult = error_code;
+    if(self->AsyncDoneCallback != NULL) self->AsyncDoneCallback(error_code);
+
+    self->cacheServing = false;
+    self->asyncBusy = false;
+    vTaskDelete(NULL);
+}
+
+// quality is allocated up front, the arena is only used by this task
+int OpenWeatherOneCall::createConcurrent(void)
+{
+    if(!quality)
+        {
+            quality = (struct airQuality *)OpenWeatherOneCall::allocate(1,sizeof(struct airQuality));
+            if(quality == NULL) return 23;
+        }
+
+    aqJoin = xSemaphoreCreateBinary();
+    if(aqJoin == NULL) return 23;
+
+    aqOffset = location.timezoneOffset;
+    BaseType_t core = (portNUM_PROCESSORS > 1) ? ((xPortGetCoreID() == 0) ? 1 : 0) : tskNO_AFFINITY;
+    if(xTaskCreatePinnedToCore(OpenWeatherOneCall::aqTask,"OWOC AQ",ASYNC_STACK,this,ASYNC_PRIORITY,NULL,core) != pdPASS)
+        {
+            vSemaphoreDelete(aqJoin);
+            aqJoin = NULL;
+            return 23;
+        }
+
+    int error_code = OpenWeatherOneCall::createCurrent();
+
+    xSemaphoreTake(aqJoin,portMAX_DELAY);
+    vSemaphoreDelete(aqJoin);
+    aqJoin = NULL;
+
+    // The One Call error comes first, it carries most of the data
+    return error_code ? error_code : aqResult;
+}
+
+void OpenWeatherOneCall::aqTask(void *owoc)
+{
+    OpenWeatherOneCall *self = (OpenWeatherOneCall *)owoc;
+
+    self->aqResult = self->createAQ(self->aqSession,self->aqOffset);
+    xSemaphoreGive(self->aqJoin);
+    vTaskDelete(NULL);
+}
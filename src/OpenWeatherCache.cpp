@@ -0,0 +1,72 @@
+/*
+   OpenWeatherCache.cpp
+   parseWeather() keeps the results of the last refresh, keyed on the
+   request parameters. Within the TTL they are served without touching
+   the network. For the stale window after it they are still served
+   while parseWeatherAsync() refreshes them in the background. That
+   refresh fills the spare snapshot set, so a stale window turns on
+   SNAPSHOT_ON (and can't be had with an arena): while isRefreshing(),
+   read the served results through readSnapshot(). parseWeather()
+   returns 28 during an async refresh that has no cache entry to serve.
+
+   OpenWeather updates One Call data about every 10 minutes.
+*/
+
+#include "OpenWeatherOneCall.h"
+
+int OpenWeatherOneCall::setCache(unsigned long _TTL_S, unsigned long _STALE_S)
+{
+    if(_STALE_S && (snapshotMode != SNAPSHOT_ON))
+        {
+            int error_code = OpenWeatherOneCall::setSnapshots(SNAPSHOT_ON);
+            if(error_code) return error_code;
+        }
+    cacheTTL = _TTL_S * 1000;
+    cacheStale = _STALE_S * 1000;
+    if(cacheTTL == 0) cacheValid = false;
+    return 0;
+}
+
+int OpenWeatherOneCall::getCacheStatus(void)
+{
+    return cacheStatus;
+}
+
+void OpenWeatherOneCall::makeRequestKey(struct requestKey &key)
+{
+    memset(&key,0,sizeof(key)); // Padding takes part in the compare
+    key.latitude = USER_PARAM.OPEN_WEATHER_LATITUDE;
+    key.longitude = USER_PARAM.OPEN_WEATHER_LONGITUDE;
+    key.units = USER_PARAM.OPEN_WEATHER_UNITS;
+    key.excludes = USER_PARAM.OPEN_WEATHER_EXCLUDES;
+    key.history = USER_PARAM.OPEN_WEATHER_HISTORY;
+    key.dateFormat = USER_PARAM.OPEN_WEATHER_DATEFORMAT;
+    key.series = seriesMode;
+    key.days = NUM_DAYS;
+    key.hours = NUM_HOURS;
+    key.minutes = NUM_MINUTES;
+    snprintf(key.language,sizeof(key.language),"%s",USER_PARAM.OPEN_WEATHER_LANGUAGE);
+}
+
+int OpenWeatherOneCall::cacheLookup(void)
+{
+    if(!cacheValid || (cacheTTL == 0)) return CACHE_MISS;
+
+    struct requestKey key;
+    OpenWeatherOneCall::makeRequestKey(key);
+    if(memcmp(&key,&cacheKey,sizeof(key))) return CACHE_MISS;
+
+    unsigned long age = millis() - cacheTime;
+    if(age < cacheTTL) return CACHE_FRESH;
+    if(age - cacheTTL < cacheStale) return CACHE_STALE;
+    return CACHE_MISS;
+}
+
+// Only a complete refresh is served again
+void OpenWeatherOneCall::cacheStore(const struct requestKey &key, int error_code)
+{
+    if(error_code) return;
+    cacheKey = key;
+    cacheTime = millis();
+    cacheValid = true;
+}
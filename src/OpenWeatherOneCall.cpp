@@ -17,11 +17,24 @@
 #endif
 
 #include "OpenWeatherOneCall.h"
-void dateTimeConversion(long _epoch, char *_buffer, int _format);
+#include "jsonFilters.h"
+#include "FieldMap.h"
+#include "WeatherConditions.h"
+#include "CityIndex.h"
+void dateTimeConversion(long _epoch, char *_buffer, size_t _size, int _format);
+
+// Where the text of forecast[x] and history[0] is, see OWOC_SPLIT_RECORDS
+#ifdef OWOC_SPLIT_RECORDS
+#define FORECAST_TEXT(x) forecastText[x]
+#define HISTORY_TEXT historyText[0]
+#else
+#define FORECAST_TEXT(x) forecast[x]
+#define HISTORY_TEXT history[0]
+#endif
 
 OpenWeatherOneCall::OpenWeatherOneCall()
 {
-
+    exclude.all_excludes = 0;
 }
 
 // For setting API KEY *************
@@ -29,6 +42,7 @@ OpenWeatherOneCall::OpenWeatherOneCall()
 
 // For Normal Weather calls *************
 #define DS_URL1 "https://api.openweathermap.org/data/3.0/onecall"
+#define EXCLUDE_PARAM "&exclude="
 
 // For Air Quality calls current April 2024 not on 3.0 *************
 #define AQ_URL1 "https://api.openweathermap.org/data/2.5/air_pollution?lat="
@@ -43,6 +57,10 @@ OpenWeatherOneCall::OpenWeatherOneCall()
 #define DA_URL1 "https://api.openweathermap.org/data/3.0/onecall/day_summary"
 #define DA_URL2 "&date="
 
+// For IP location calls
+#define IP_URL "https://ipapi.co/"
+#define IP_SELF_URL "https://ipapi.co/json/" // Address taken from the request
+
 // For CITY Id calls
 #define CI_URL1 "http://api.openweathermap.org/data/3.0/weather?id="
 
@@ -50,19 +68,55 @@ OpenWeatherOneCall::OpenWeatherOneCall()
 
 // Main Method for Weather API Call and Parsing
 int OpenWeatherOneCall::parseWeather(void)
+{
+    // A refresh is running on the async task, only a stale entry it replaces is served meanwhile
+    if(asyncBusy)
+        {
+            if(!cacheServing) return 28;
+            cacheStatus = CACHE_STALE;
+            return 0;
+        }
+
+    cacheStatus = OpenWeatherOneCall::cacheLookup();
+    if(cacheStatus == CACHE_FRESH) return 0;
+    if(cacheStatus == CACHE_STALE)
+        {
+            cacheServing = true;
+            if(OpenWeatherOneCall::parseWeatherAsync(NULL)) cacheServing = false;
+            return 0;
+        }
+
+    return OpenWeatherOneCall::fetchWeather();
+}
+
+// Network side of parseWeather()
+int OpenWeatherOneCall::fetchWeather(void)
 {
     int error_code = 0;
+    struct requestKey key;
+
+    OpenWeatherOneCall::makeRequestKey(key);
 
     if (WiFi.status() != WL_CONNECTED)
         {
             return 25;
         }
 
+    cacheValid = false; // Results change from here on
     if((USER_PARAM.OPEN_WEATHER_LATITUDE) || (USER_PARAM.OPEN_WEATHER_LONGITUDE))
         {
+            // Last refresh's results go all at once
+            if(arena.active()) OpenWeatherOneCall::resetArena();
+            if(arenaFit && (arena.capacity() < OpenWeatherOneCall::getArenaSize()))
+                {
+                    error_code = arena.begin(OpenWeatherOneCall::getArenaSize());
+                    if(error_code) return error_code;
+                }
+
             error_code = OpenWeatherOneCall::getLocationInfo();
             if(error_code) return error_code;
 
+            OpenWeatherOneCall::beginSnapshot();
             if(USER_PARAM.OPEN_WEATHER_HISTORY)  //If Historical Weather is requested, no CURRENT weather returned
                 {
                     OpenWeatherOneCall::freeCurrentMem();
@@ -71,24 +125,41 @@ int OpenWeatherOneCall::parseWeather(void)
                     OpenWeatherOneCall::freeAlertMem();
                     OpenWeatherOneCall::freeHourMem();
                     OpenWeatherOneCall::freeMinuteMem();
+                    OpenWeatherOneCall::freeSeriesMem();
 
                     error_code = OpenWeatherOneCall::createHistory();
                 }
             else
                 {    // Current waether call
                     OpenWeatherOneCall::freeHistoryMem();
-                    error_code = OpenWeatherOneCall::createAQ();
-                    if(error_code == 0) 
-						{
-							error_code = OpenWeatherOneCall::createCurrent();
-						}
+                    if(exclude.quality)
+                        {
+                            OpenWeatherOneCall::freeQualityMem();
+                            error_code = OpenWeatherOneCall::createCurrent();
+                        }
+                    else if(USER_PARAM.OPEN_WEATHER_FETCH == CONCURRENT_FETCH)
+                        {
+                            error_code = OpenWeatherOneCall::createConcurrent();
+                        }
+                    else
+                        {
+                            error_code = OpenWeatherOneCall::createAQ(session,location.timezoneOffset);
+                            if(error_code == 0) 
+                                {
+                                    error_code = OpenWeatherOneCall::createCurrent();
+                                }
+                        }
                 }
+            OpenWeatherOneCall::endSnapshot(error_code);
         }
     else
         {
             error_code = 24; //Must set Latitude and Longitude somehow
         }
 
+    session.endRefresh();
+    aqSession.endRefresh();
+    OpenWeatherOneCall::cacheStore(key,error_code);
     return error_code;
 }
 
@@ -142,6 +213,11 @@ int OpenWeatherOneCall::setLatLon(float _LAT, float _LON)
 int OpenWeatherOneCall::setLatLon(int _CITY_ID)
 {
     char cityURL[110];
+    float latitude, longitude;
+
+    // North American IDs are in the offline table, see CityIndex.h
+    if(findCityCoordinates(_CITY_ID,latitude,longitude))
+        return OpenWeatherOneCall::setLatLon(latitude,longitude);
 
     sprintf(cityURL,"%s%d%s%s",CI_URL1,_CITY_ID,API_URL,USER_PARAM.OPEN_WEATHER_DKEY);
     return OpenWeatherOneCall::parseCityCoordinates(cityURL);
@@ -151,11 +227,47 @@ int OpenWeatherOneCall::setLatLon(void)
 {
     // IP address of NON-CELLULAR WiFi. Hotspots won't work properly.
     int error_code = 0;
-    error_code = OpenWeatherOneCall::getIPLocation();
+
+    if(ipLocation.valid && (millis() - ipLocation.time < ipLocationTTL))
+        {
+            USER_PARAM.OPEN_WEATHER_LATITUDE = location.LATITUDE = ipLocation.latitude;
+            USER_PARAM.OPEN_WEATHER_LONGITUDE = location.LONGITUDE = ipLocation.longitude;
+            strncpy(location.CITY,ipLocation.CITY,60);
+            strncpy(location.STATE,ipLocation.STATE,10);
+            strncpy(location.COUNTRY,ipLocation.COUNTRY,10);
+            return 0;
+        }
+
+    if(ipLookup == IP_TWO_STEP)
+        {
+            error_code = OpenWeatherOneCall::getIPLocation();
+            if(error_code) return error_code;
+            error_code = OpenWeatherOneCall::getIPAPILocation(_ipapiURL);
+        }
+    else
+        {
+            error_code = OpenWeatherOneCall::getIPAPILocation((char *)IP_SELF_URL);
+        }
     if(error_code) return error_code;
 
-    error_code = OpenWeatherOneCall::getIPAPILocation(_ipapiURL);
-	return error_code;
+    ipLocation.latitude = location.LATITUDE;
+    ipLocation.longitude = location.LONGITUDE;
+    memcpy(ipLocation.CITY,location.CITY,60);
+    memcpy(ipLocation.STATE,location.STATE,10);
+    memcpy(ipLocation.COUNTRY,location.COUNTRY,10);
+    ipLocation.time = millis();
+    ipLocation.valid = (ipLocationTTL > 0);
+	return 0;
+}
+
+int OpenWeatherOneCall::setIPLocationMode(int _MODE, unsigned long _TTL_S)
+{
+    if((_MODE != IP_ONE_STEP) && (_MODE != IP_TWO_STEP))
+        return 31;
+    ipLookup = _MODE;
+    ipLocationTTL = _TTL_S * 1000UL;
+    ipLocation.valid = false;
+    return 0;
 }
 
 
@@ -173,14 +285,16 @@ int OpenWeatherOneCall::parseCityCoordinates(char* CTY_URL)
             return ( (httpCode == 404) ? 4 : 5);
         }
 
+    JsonDocument filter;
+    deserializeJson(filter,filter_city);
     JsonDocument doc;
 #ifdef DEBUG_TO_SERIAL
 	// Send copy of http data to serial port
 	ReadLoggingStream loggingStream(http.getStream(), Serial);
-	DeserializationError JSON_error = deserializeJson(doc, loggingStream);
+	DeserializationError JSON_error = deserializeJson(doc, loggingStream, DeserializationOption::Filter(filter));
 	Serial.println("");
 #else
-	DeserializationError JSON_error = deserializeJson(doc, http.getStream()); // Increased stability
+	DeserializationError JSON_error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter)); // Increased stability
 #endif
 
     http.end();
@@ -193,6 +307,7 @@ int OpenWeatherOneCall::parseCityCoordinates(char* CTY_URL)
     if(doc["coord"]["lon"])
         {
             USER_PARAM.OPEN_WEATHER_LONGITUDE = doc["coord"]["lon"]; // -74.2
+            location.LONGITUDE = USER_PARAM.OPEN_WEATHER_LONGITUDE; //User copy
         }
     else
         {
@@ -202,6 +317,7 @@ int OpenWeatherOneCall::parseCityCoordinates(char* CTY_URL)
     if(doc["coord"]["lat"])
         {
             USER_PARAM.OPEN_WEATHER_LATITUDE = doc["coord"]["lat"]; // 39.95
+            location.LATITUDE = USER_PARAM.OPEN_WEATHER_LATITUDE; //User copy
         }
     else
         {
@@ -223,17 +339,16 @@ int OpenWeatherOneCall::getIPLocation()
             return ( (httpCode == 404) ? 8 : 9);
         }
 
-    int streamSize = http.getSize();
-    char stringVarout[streamSize+1];
-
+    // getSize() is -1 for a chunked body, an address is at most 45 chars (IPv6)
+    char ipAddress[46];
     String stringVarin = http.getString();
-    strcpy(stringVarout,stringVarin.c_str());
+    strncpy(ipAddress,stringVarin.c_str(),sizeof(ipAddress) - 1);
+    ipAddress[sizeof(ipAddress) - 1] = '\0';
+    ipAddress[strcspn(ipAddress," \r\n")] = '\0';
 
     http.end();
 
-    strncpy(_ipapiURL,"https://ipapi.co/",38);
-    strcat(_ipapiURL,stringVarout);
-    strcat(_ipapiURL,"/json/");
+    snprintf(_ipapiURL,sizeof(_ipapiURL),"%s%s/json/",IP_URL,ipAddress);
 
     return 0;
 }
@@ -251,15 +366,17 @@ int OpenWeatherOneCall::getIPAPILocation(char* URL)
             return ( (ipapi_httpCode == 404) ? 10 : 11);
         }
 
+    JsonDocument filter;
+    deserializeJson(filter,filter_ipapi);
     JsonDocument doc;
 
 #ifdef DEBUG_TO_SERIAL
 	// Send copy of http data to serial port
 	ReadLoggingStream loggingStream(http.getStream(), Serial);
-	DeserializationError JSON_error = deserializeJson(doc, loggingStream);
+	DeserializationError JSON_error = deserializeJson(doc, loggingStream, DeserializationOption::Filter(filter));
 	Serial.println("");
 #else
-	DeserializationError JSON_error = deserializeJson(doc, http.getStream()); // Increased stability
+	DeserializationError JSON_error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter)); // Increased stability
 #endif
 
     http.end();
@@ -288,17 +405,20 @@ void OpenWeatherOneCall::initAPI(void)
     USER_PARAM.OPEN_WEATHER_UNITS = IMPERIAL;
     USER_PARAM.OPEN_WEATHER_EXCLUDES = 0;
     USER_PARAM.OPEN_WEATHER_HISTORY = 0;
+    exclude.all_excludes = 0;
 }
 
 
 int OpenWeatherOneCall::getLocationInfo()
 {
-static bool bDone = false ;
-
-	if (bDone) return 0;
-	bDone = true;
-	
-    int error_code = 0;
+    const LocationEntry *place = locations->find(USER_PARAM.OPEN_WEATHER_LATITUDE,USER_PARAM.OPEN_WEATHER_LONGITUDE);
+    if(place)
+        {
+            strncpy(location.CITY,place->CITY,60);
+            strncpy(location.STATE,place->STATE,10);
+            strncpy(location.COUNTRY,place->COUNTRY,10);
+            return 0;
+        }
 
     char locationURL[200];
 
@@ -319,14 +439,16 @@ static bool bDone = false ;
 			else return 19;
         }
 
+    JsonDocument filter;
+    deserializeJson(filter,filter_reverse_geocode);
     JsonDocument doc;
 #ifdef DEBUG_TO_SERIAL
 	// Send copy of http data to serial port
 	ReadLoggingStream loggingStream(http.getStream(), Serial);
-	DeserializationError JSON_error = deserializeJson(doc, loggingStream);
+	DeserializationError JSON_error = deserializeJson(doc, loggingStream, DeserializationOption::Filter(filter));
 	Serial.println("");
 #else
-	DeserializationError JSON_error = deserializeJson(doc, http.getStream()); // Increased stability
+	DeserializationError JSON_error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter)); // Increased stability
 #endif
 
     http.end();
@@ -363,6 +485,7 @@ static bool bDone = false ;
             return 20;
         }
 
+    locations->store(USER_PARAM.OPEN_WEATHER_LATITUDE,USER_PARAM.OPEN_WEATHER_LONGITUDE,location.CITY,location.STATE,location.COUNTRY);
     return 0;
 }
 
@@ -391,9 +514,7 @@ int OpenWeatherOneCall::createHistory()
 			Serial.printf("%s\n\r",getURL);
 #endif
 
-            http.useHTTP10(true); // To enable http.getStream()
-            http.begin(getURL);
-            httpCode = http.GET();
+            httpCode = session.request(http,getURL); // Shared keep-alive connection
 
             if (httpCode > 399)
                 {
@@ -403,14 +524,16 @@ int OpenWeatherOneCall::createHistory()
 					return 21;
                 }
 
+            JsonDocument filter;
+            deserializeJson(filter,filter_epoch);
             JsonDocument toc;
 #ifdef DEBUG_TO_SERIAL
 			// Send copy of http data to serial port
 			ReadLoggingStream loggingStream(http.getStream(), Serial);
-			DeserializationError JSON_error = deserializeJson(toc, loggingStream);
+			DeserializationError JSON_error = deserializeJson(toc, loggingStream, DeserializationOption::Filter(filter));
 			Serial.println("");
 #else
-			DeserializationError JSON_error = deserializeJson(toc, http.getStream()); // Increased stability
+			DeserializationError JSON_error = deserializeJson(toc, http.getStream(), DeserializationOption::Filter(filter)); // Increased stability
 #endif
 
 			http.end();
@@ -433,9 +556,7 @@ int OpenWeatherOneCall::createHistory()
 	Serial.printf("%s\n\r",getURL);
 #endif
     
-    http.useHTTP10(true); // To enable http.getStream()
-    http.begin(getURL);
-    httpCode = http.GET();
+    httpCode = session.request(http,getURL); // Shared keep-alive connection
 
 	if (httpCode > 399)
 		{
@@ -445,14 +566,16 @@ int OpenWeatherOneCall::createHistory()
 			return 21;
 		}
 
+    JsonDocument filter;
+    deserializeJson(filter,filter_timemachine);
     JsonDocument doc;
 #ifdef DEBUG_TO_SERIAL
 	// Send copy of http data to serial port
 	ReadLoggingStream loggingStream(http.getStream(), Serial);
-	DeserializationError JSON_error = deserializeJson(doc, loggingStream);
+	DeserializationError JSON_error = deserializeJson(doc, loggingStream, DeserializationOption::Filter(filter));
 	Serial.println("");
 #else
-	DeserializationError JSON_error = deserializeJson(doc, http.getStream()); // Increased stability
+	DeserializationError JSON_error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter)); // Increased stability
 #endif
 
     http.end();
@@ -467,91 +590,51 @@ int OpenWeatherOneCall::createHistory()
 
     if(!history)
         {
-            history = (struct HISTORICAL *)calloc(1,sizeof(struct HISTORICAL));
+            history = (struct HISTORICAL *)OpenWeatherOneCall::allocate(1,sizeof(struct HISTORICAL));
             if(history == NULL) return 23;
         }
-
-    //Current in historical is the time of the request on that day
-    JsonObject current = doc["data"][0];
-    history[0].dayTime = current["dt"]; // 1607292481
-    if(current["dt"])
+#ifdef OWOC_SPLIT_RECORDS
+    if(!historyText)
         {
-            long tempTime = current["dt"];
-            tempTime += location.timezoneOffset;
-            dateTimeConversion(tempTime,history[0].readableDateTime,USER_PARAM.OPEN_WEATHER_DATEFORMAT);
+            historyText = (struct recordText *)OpenWeatherOneCall::allocate(1,sizeof(struct recordText));
+            if(historyText == NULL) return 23;
         }
+#endif
 
-    history[0].sunrise = current["sunrise"]; // 1607256309
-    if(current["sunrise"])
-        {
-            long tempTime = current["sunrise"];
-            tempTime += location.timezoneOffset;
-            dateTimeConversion(tempTime,history[0].readableSunrise,USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
-        }
+    //Current in historical is the time of the request on that day
+    FillOptions fill = {USER_PARAM.OPEN_WEATHER_UNITS, arena.active() ? &arena : NULL, NULL, 0};
+#ifdef OWOC_SPLIT_RECORDS
+    fill.cold = historyText;
+#endif
+    clearFields(map_timemachine,history);
+    error_code = fillFields(map_timemachine,history,doc["data"][0],fill);
+    if(error_code) return error_code;
 
-    history[0].sunset = current["sunset"]; // 1607290280
-    if(current["sunset"])
+#ifndef OWOC_LAZY_DATES
+    if(history[0].dayTime)
         {
-            long tempTime = current["sunset"];
-            tempTime += location.timezoneOffset;
-            dateTimeConversion(tempTime,history[0].readableSunset,USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
+            dateTimeConversion(history[0].dayTime + location.timezoneOffset,HISTORY_TEXT.readableDateTime,sizeof(HISTORY_TEXT.readableDateTime),USER_PARAM.OPEN_WEATHER_DATEFORMAT);
         }
-
-    history[0].temperature = current["temp"]; // 35.82
-    history[0].apparentTemperature = current["feels_like"]; // 21.7
-    history[0].pressure = current["pressure"]; // 1010
-    history[0].humidity = current["humidity"]; // 51
-    history[0].dewPoint = current["dew_point"]; // 20.88
-    history[0].uvIndex = current["uvi"]; // 1.54
-    history[0].cloudCover = current["clouds"]; // 1
-    history[0].visibility = current["visibility"]; // 16093
-    history[0].windSpeed = current["wind_speed"]; // 16.11
-    history[0].windBearing = current["wind_deg"]; // 300
-    history[0].windGust = current["wind_gust"]; // 24.16
-
-    // New rain and snow =======================
-    if(current["rain"]["1h"])
+    if(history[0].sunrise)
         {
-			history[0].rainVolume = current["rain"]["1h"]; // To be checked?
-            if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                {
-                    history[0].rainVolume /= 25.4; // inch
-                }
-        } else history[0].rainVolume = 0;
-
-    if(current["snow"])
+            dateTimeConversion(history[0].sunrise + location.timezoneOffset,HISTORY_TEXT.readableSunrise,sizeof(HISTORY_TEXT.readableSunrise),USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
+        }
+    if(history[0].sunset)
         {
-            history[0].snowVolume = current["snow"]["1h"]; // 95
-			if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                {
-                    history[0].snowVolume /= 25.4; // 95
-                }
-        } else history[0].snowVolume = 0;
-
-    JsonObject cur_weather = current["weather"][0];
-	history[0].id = cur_weather["id"]; // 800
-	history[0].main = (char *)realloc(history[0].main,sizeof(char) * strlen(cur_weather["main"])+1);
-	if(history[0].main == NULL) return 23;
-	strncpy(history[0].main,cur_weather["main"],strlen(cur_weather["main"])+1);
-
-	history[0].summary = (char *)realloc(history[0].summary,sizeof(char) * strlen(cur_weather["description"])+1);
-	if(history[0].summary == NULL) return 23;
-	strncpy(history[0].summary,cur_weather["description"],strlen(cur_weather["description"])+1);
-
-	strncpy(history[0].icon,cur_weather["icon"],strlen(cur_weather["icon"])+1);
-	dateTimeConversion(history[0].dayTime,history[0].weekDayName,9);
+            dateTimeConversion(history[0].sunset + location.timezoneOffset,HISTORY_TEXT.readableSunset,sizeof(HISTORY_TEXT.readableSunset),USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
+        }
+	dateTimeConversion(history[0].dayTime,HISTORY_TEXT.weekDayName,sizeof(HISTORY_TEXT.weekDayName),9);
+#endif
 
     //Daily Aggregation request to OWM
     char HS_Date[12];
-	dateTimeConversion(tempEPOCH, HS_Date, 10);
+	dateTimeConversion(tempEPOCH, HS_Date, sizeof(HS_Date), 10);
     sprintf(getURL,"%s?lat=%.6f&lon=%.6f%s%s&units=%s%s%s",DA_URL1,USER_PARAM.OPEN_WEATHER_LATITUDE,USER_PARAM.OPEN_WEATHER_LONGITUDE,DA_URL2,HS_Date,units,API_URL,USER_PARAM.OPEN_WEATHER_DKEY);
 #ifdef DEBUG_TO_SERIAL
 	Serial.printf("%s\n\r",getURL);
 #endif
     
-    http.useHTTP10(true); // To enable http.getStream()
-    http.begin(getURL);
-    httpCode = http.GET();
+    httpCode = session.request(http,getURL); // Shared keep-alive connection
 
 	if (httpCode > 399)
 		{
@@ -561,14 +644,16 @@ int OpenWeatherOneCall::createHistory()
 			return 21;
 		}
 
+    JsonDocument daytotalFilter;
+    deserializeJson(daytotalFilter,filter_day_summary);
     JsonDocument daytotal;
 #ifdef DEBUG_TO_SERIAL
 	// Send copy of http data to serial port
 	ReadLoggingStream loggingStream2(http.getStream(), Serial);
-	JSON_error = deserializeJson(daytotal, loggingStream2);
+	JSON_error = deserializeJson(daytotal, loggingStream2, DeserializationOption::Filter(daytotalFilter));
 	Serial.println("");
 #else
-	JSON_error = deserializeJson(daytotal, http.getStream()); // Increased stability
+	JSON_error = deserializeJson(daytotal, http.getStream(), DeserializationOption::Filter(daytotalFilter)); // Increased stability
 #endif
 
     http.end();
@@ -578,27 +663,12 @@ int OpenWeatherOneCall::createHistory()
 			return 25;
 		}
 
-	history[0].h12_cloudCover  = daytotal["cloud_cover"]["afternoon"];
-	history[0].h12_humidity    = daytotal["humidity"]["afternoon"];
-	history[0].day_rainVolume  = daytotal["precipitation"]["total"];
-	history[0].h12_pressure    = daytotal["pressure"]["afternoon"];
-
-	JsonObject histemp = daytotal["temperature"];
-	history[0].min_temperature = histemp["min"];
-	history[0].max_temperature = histemp["max"];
-	history[0].h00_temperature = histemp["night"];
-	history[0].h06_temperature = histemp["morning"];
-	history[0].h12_temperature = histemp["afternoon"];
-	history[0].h18_temperature = histemp["evening"];
-	
-	JsonObject wind = daytotal["wind"]["max"];
-	history[0].max_windSpeed   = wind["speed"];
-	history[0].max_windBearing = wind["direction"];
-
-    return 0;
+    clearFields(map_day_summary,history);
+    return fillFields(map_day_summary,history,daytotal.as<JsonObject>(),fill);
 }
 
-int OpenWeatherOneCall::createAQ()
+// offset is passed in, with CONCURRENT_FETCH createCurrent() is setting it meanwhile
+int OpenWeatherOneCall::createAQ(OpenWeatherSession &link, int offset)
 {
     char getURL[200];
 
@@ -608,9 +678,7 @@ int OpenWeatherOneCall::createAQ()
 #endif
 
     HTTPClient http;
-    http.useHTTP10(true); // To enable http.getStream()
-    http.begin(getURL);
-    int httpCode = http.GET();
+    int httpCode = link.request(http,getURL); // Shared keep-alive connection
 
 	if (httpCode > 399)
 		{
@@ -620,14 +688,16 @@ int OpenWeatherOneCall::createAQ()
 			return 21;
 		}
 
+    JsonDocument filter;
+    deserializeJson(filter,filter_air_pollution);
     JsonDocument doc;
 #ifdef DEBUG_TO_SERIAL
 	// Send copy of http data to serial port
 	ReadLoggingStream loggingStream(http.getStream(), Serial);
-	DeserializationError JSON_error = deserializeJson(doc, loggingStream);
+	DeserializationError JSON_error = deserializeJson(doc, loggingStream, DeserializationOption::Filter(filter));
 	Serial.println("");
 #else
-	DeserializationError JSON_error = deserializeJson(doc, http.getStream()); // Increased stability
+	DeserializationError JSON_error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter)); // Increased stability
 #endif
 
     http.end();
@@ -639,45 +709,37 @@ int OpenWeatherOneCall::createAQ()
     doc.shrinkToFit();
 
     if(!quality) { // Avoid memory leak
-        quality = (struct airQuality *)calloc(1,sizeof(struct airQuality));
+        quality = (struct airQuality *)OpenWeatherOneCall::allocate(1,sizeof(struct airQuality));
         if(quality == NULL) return 23;
     }
 
-    float coord_lon = doc["coord"]["lon"]; // -74.1975
-    float coord_lat = doc["coord"]["lat"]; // 39.9533
-
-    JsonObject list_0 = doc["list"][0];
-
-    quality -> aqi = list_0["main"]["aqi"]; // 2
-
-    JsonObject list_0_components = list_0["components"];
-    quality -> co = list_0_components["co"]; // 230.31
-    quality -> no = list_0_components["no"]; // 0.43
-    quality -> no2 = list_0_components["no2"]; // 1.69
-    quality -> o3 = list_0_components["o3"]; // 100.14
-    quality -> so2 = list_0_components["so2"]; // 0.88
-    quality -> pm2_5 = list_0_components["pm2_5"]; // 0.76
-    quality -> pm10 = list_0_components["pm10"]; // 1.04
-    quality -> nh3 = list_0_components["nh3"]; // 0.43
+    FillOptions fill = {USER_PARAM.OPEN_WEATHER_UNITS, arena.active() ? &arena : NULL, NULL, 0};
+    clearFields(map_air_quality,quality);
+    int error_code = fillFields(map_air_quality,quality,doc["list"][0],fill);
+    if(error_code) return error_code;
 
-    quality -> dayTime = list_0["dt"]; // 1615838400
-	dateTimeConversion(quality->dayTime+location.timezoneOffset,quality->readableDateTime,USER_PARAM.OPEN_WEATHER_DATEFORMAT);
+#ifndef OWOC_LAZY_DATES
+	dateTimeConversion(quality->dayTime+offset,quality->readableDateTime,sizeof(quality->readableDateTime),USER_PARAM.OPEN_WEATHER_DATEFORMAT);
+#else
+    (void)offset;
+#endif
 
     return 0;
 }
 
 int OpenWeatherOneCall::createCurrent()
 {
-    char getURL[200];
-    sprintf(getURL,"%s?lat=%.6f&lon=%.6f&lang=%s&units=%s%s%s",DS_URL1,USER_PARAM.OPEN_WEATHER_LATITUDE,USER_PARAM.OPEN_WEATHER_LONGITUDE,USER_PARAM.OPEN_WEATHER_LANGUAGE,units,API_URL,USER_PARAM.OPEN_WEATHER_DKEY);
+    char getURL[250];
+    char excludeQuery[sizeof(EXCLUDE_PARAM) + 40];
+
+    OpenWeatherOneCall::buildExcludeQuery(excludeQuery);
+    sprintf(getURL,"%s?lat=%.6f&lon=%.6f%s&lang=%s&units=%s%s%s",DS_URL1,USER_PARAM.OPEN_WEATHER_LATITUDE,USER_PARAM.OPEN_WEATHER_LONGITUDE,excludeQuery,USER_PARAM.OPEN_WEATHER_LANGUAGE,units,API_URL,USER_PARAM.OPEN_WEATHER_DKEY);
 #ifdef DEBUG_TO_SERIAL
 	Serial.printf("%s\n\r",getURL);
 #endif
 
     HTTPClient http;
-    http.useHTTP10(true); // To enable http.getStream()
-    http.begin(getURL);
-    int httpCode = http.GET();
+    int httpCode = session.request(http,getURL); // Shared keep-alive connection
 
 	if (httpCode > 399)
 		{
@@ -687,15 +749,30 @@ int OpenWeatherOneCall::createCurrent()
 			return 21;
 		}
 
+    if(USER_PARAM.OPEN_WEATHER_PARSER == STREAM_PARSER)
+        {
+#ifdef DEBUG_TO_SERIAL
+            ReadLoggingStream loggingStream(http.getStream(), Serial);
+            int error_code = OpenWeatherOneCall::parseOneCallStream(loggingStream);
+            Serial.println("");
+#else
+            int error_code = OpenWeatherOneCall::parseOneCallStream(http.getStream());
+#endif
+            http.end();
+            return error_code;
+        }
+
+    JsonDocument filter;
+    OpenWeatherOneCall::buildOneCallFilter(filter);
     JsonDocument doc;
 
 #ifdef DEBUG_TO_SERIAL
 	// Send copy of http data to serial port
 	ReadLoggingStream loggingStream(http.getStream(), Serial);
-	DeserializationError JSON_error = deserializeJson(doc, loggingStream);
+	DeserializationError JSON_error = deserializeJson(doc, loggingStream, DeserializationOption::Filter(filter));
 	Serial.println("");
 #else
-	DeserializationError JSON_error = deserializeJson(doc, http.getStream()); // Increased stability
+	DeserializationError JSON_error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter)); // Increased stability
 #endif
 
     http.end();
@@ -706,10 +783,14 @@ int OpenWeatherOneCall::createCurrent()
 		}
     doc.shrinkToFit();
 
-    if (doc["timezone"] == NULL) return 23;
-    strncpy(location.timezone,doc["timezone"],50);
+    const char *timezone = doc["timezone"]; // NULL when missing or not a string
+    if (timezone == NULL) return 23;
+    strncpy(location.timezone,timezone,50);
     location.timezoneOffset = doc["timezone_offset"];
 
+    FillOptions fill = {USER_PARAM.OPEN_WEATHER_UNITS, arena.active() ? &arena : NULL, NULL, 0};
+    int error_code = 0;
+
     if(exclude.current)
         {
             OpenWeatherOneCall::freeCurrentMem();
@@ -718,93 +799,13 @@ int OpenWeatherOneCall::createCurrent()
         {
             if(!current)
                 {
-                    current = (struct nowData *)calloc(1,sizeof(struct nowData));
+                    current = (struct nowData *)OpenWeatherOneCall::allocate(1,sizeof(struct nowData));
                     if(current == NULL) return 23;
                 }
 
-            JsonObject currently = doc["current"];
-            current->dayTime = currently["dt"]; // 1586781931
-
-            if(currently["dt"])
-                {
-                    long tempTime = currently["dt"];
-                    tempTime += location.timezoneOffset;
-                    dateTimeConversion(tempTime,current->readableDateTime,USER_PARAM.OPEN_WEATHER_DATEFORMAT);
-                    dateTimeConversion(tempTime,current->readableWeekdayName,9);
-                }
-
-            current->sunriseTime = currently["sunrise"]; // 1612267442
-
-            if(currently["sunrise"])
-                {
-                    long tempTime = currently["sunrise"];
-                    tempTime += location.timezoneOffset;
-                    dateTimeConversion(tempTime,current->readableSunrise,USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
-                }
-
-            current->sunsetTime = currently["sunset"]; // 1612304218
-
-            if(currently["sunset"])
-                {
-                    long tempTime = currently["sunset"];
-                    tempTime += location.timezoneOffset;
-                    dateTimeConversion(tempTime,current->readableSunset,USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
-                }
-
-            current->temperature = currently["temp"]; // 287.59
-            current->apparentTemperature = currently["feels_like"]; // 281.42
-            current->pressure = currently["pressure"]; // 1011
-            current->humidity = currently["humidity"]; // 93
-            current->dewPoint = currently["dew_point"]; // 286.47
-            current->uvIndex = currently["uvi"]; // 6.31
-            current->cloudCover = currently["clouds"]; // 90
-            current->visibility = currently["visibility"]; // 8047
-            current->windSpeed = currently["wind_speed"]; // 10.3
-            current->windBearing = currently["wind_deg"]; // 170
-
-            if(currently["wind_gust"])
-                {
-                    current->windGust = currently["wind_gust"];
-                }
-
-            if(currently["snow"]["1h"])
-                {
-                    current->snowVolume = currently["snow"]["1h"]; // 95
-					if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                        {
-                            current->snowVolume /= 25.4; // 95
-                        }
-                } else current->snowVolume = 0;
-
-            if(currently["rain"]["1h"])
-                {
-                    current->rainVolume = currently["rain"]["1h"]; // checked needs 1h
-					if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                        {
-                            current->rainVolume /= 25.4; // mm to inch
-                        } 
-                } else current->rainVolume = 0;
-
-            if (currently["weather"][0]["id"]) 
-            {
-                current->id = currently["weather"][0]["id"];
-            }
-
-            if(currently["weather"][0]["main"]) 
-            {
-                current->main = (char *)realloc(current->main,sizeof(char) * strlen(currently["weather"][0]["main"])+1);
-                if(current->main == NULL) return 23;
-                strncpy(current->main,currently["weather"][0]["main"],strlen(currently["weather"][0]["main"])+1);
-            }
-
-            if(currently["weather"][0]["description"]) 
-            {
-                current->summary = (char *)realloc(current->summary,sizeof(char) * strlen(currently["weather"][0]["description"])+1);
-                if(current->summary == NULL) return 23;
-                strncpy(current->summary,currently["weather"][0]["description"],strlen(currently["weather"][0]["description"])+1);
-            }
-
-            strncpy(current->icon,currently["weather"][0]["icon"],strlen(currently["weather"][0]["icon"])+1);
+            clearFields(map_current,current);
+            error_code = fillFields(map_current,current,doc["current"],fill);
+            if(error_code) return error_code;
         }
 
     if(exclude.daily)
@@ -813,258 +814,185 @@ int OpenWeatherOneCall::createCurrent()
         }
     else
         {
-            if(!forecast)
-                {
-                    forecast = (struct futureData *)calloc(8,sizeof(struct futureData));
-                    if(forecast == NULL) return 23;
-                }
-
-            JsonArray daily = doc["daily"];
-            for (int x = 0; x < 8; x++)
-                {
-                    forecast[x].dayTime = daily[x]["dt"]; // 1586793600
-
-                    if(daily[x]["dt"])
-                        {
-                            long tempTime = daily[x]["dt"];
-                            tempTime += location.timezoneOffset;
-                            dateTimeConversion(tempTime,forecast[x].readableDateTime,USER_PARAM.OPEN_WEATHER_DATEFORMAT);
-                        }
-
-                    forecast[x].sunriseTime = daily[x]["sunrise"]; // 1586773262
-
-                    if(daily[x]["sunrise"])
-                        {
-                            long tempTime = daily[x]["sunrise"];
-                            tempTime += location.timezoneOffset;
-                            dateTimeConversion(tempTime,forecast[x].readableSunrise,USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
-                        }
-
-                    forecast[x].sunsetTime = daily[x]["sunset"]; // 1586820773
-
-                    if(daily[x]["sunset"])
-                        {
-                            long tempTime = daily[x]["sunset"];
-                            tempTime += location.timezoneOffset;
-                            dateTimeConversion(tempTime,forecast[x].readableSunset,USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
-                        }
-
-                    forecast[x].temperatureDay = daily[x]["temp"]["day"]; // 288.74
-                    forecast[x].temperatureLow = daily[x]["temp"]["min"]; // 286.56
-                    forecast[x].temperatureHigh = daily[x]["temp"]["max"]; // 293.23
-                    forecast[x].temperatureNight = daily[x]["temp"]["night"]; // 286.56
-                    forecast[x].temperatureEve = daily[x]["temp"]["eve"]; // 293.23
-                    forecast[x].temperatureMorn = daily[x]["temp"]["morn"]; // 286.56
-
-                    forecast[x].apparentTemperatureHigh = daily[x]["feels_like"]["day"]; // 280.11
-                    forecast[x].apparentTemperatureLow = daily[x]["feels_like"]["night"]; // 280.29
-                    forecast[x].apparentTemperatureEve = daily[x]["feels_like"]["eve"]; // 280.11
-                    forecast[x].apparentTemperatureMorn = daily[x]["feels_like"]["morn"]; // 280.29
-
-                    forecast[x].pressure = daily[x]["pressure"]; // 1006
-                    forecast[x].humidity = daily[x]["humidity"]; // 91
-                    forecast[x].dewPoint = daily[x]["dew_point"]; // 287.28
-                    forecast[x].windSpeed = daily[x]["wind_speed"]; // 14.2
-
-                    if(daily[x]["wind_gust"])
-                        {
-                            forecast[x].windGust = daily[x]["wind_gust"];
-                        }
-
-
-                    forecast[x].windBearing = daily[x]["wind_deg"]; // 180
-
-                    forecast[x].id = daily[x]["weather"][0]["id"]; // 800
-
-                    if(daily[x]["weather"][0]["main"])
-                        {
-                            forecast[x].main = (char *)realloc(forecast[x].main,sizeof(char) * strlen(daily[x]["weather"][0]["main"])+1);
-                            if(forecast[x].main == NULL) return 23;
-                            strncpy(forecast[x].main,daily[x]["weather"][0]["main"],strlen(daily[x]["weather"][0]["main"])+1);
-                        }
-
-                    if(daily[x]["weather"][0]["description"])
-                        {
-                            forecast[x].summary = (char *)realloc(forecast[x].summary,sizeof(char) * strlen(daily[x]["weather"][0]["description"])+1);
-                            if(forecast[x].summary == NULL) return 23;
-                            strncpy(forecast[x].summary,daily[x]["weather"][0]["description"],strlen(daily[x]["weather"][0]["description"])+1);
-                        }
-                    strncpy(forecast[x].icon,daily[x]["weather"][0]["icon"],strlen(daily[x]["weather"][0]["icon"])+1);
-
-                    forecast[x].cloudCover = daily[x]["clouds"]; // 95
-                    forecast[x].pop = daily[x]["pop"]; // 95
-
-                    if(daily[x]["rain"])
-                        {
-                            forecast[x].rainVolume = daily[x]["rain"]; // checked here no 1h
-							if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                                {
-                                    forecast[x].rainVolume /= 25.4; // Inch
-                                }
-                        } else forecast[x].rainVolume = 0; // 95
-
-                    if(daily[x]["snow"])
-                        {
-                            forecast[x].snowVolume = daily[x]["snow"]; // 95
-							if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                                {
-                                    forecast[x].snowVolume /= 25.4; // 95
-                                }
-                        } else forecast[x].snowVolume = 0;
-
-                    forecast[x].uvIndex = daily[x]["uvi"]; // 6.31
-                    dateTimeConversion(forecast[x].dayTime,forecast[x].weekDayName,9);
-                }
+            FillOptions daily = fill;
+            if(OpenWeatherOneCall::allocateForecast(daily)) return 23;
 
+            error_code = fillArray(map_daily,forecast,sizeof(struct futureData),NUM_DAYS,doc["daily"],daily);
+            if(error_code) return error_code;
         }
 
-    if(exclude.alerts)
-        {
-            OpenWeatherOneCall::freeAlertMem();
-        }
-    else
+    // Always clear because of nested allocations
+    OpenWeatherOneCall::freeAlertMem();
+    if(!exclude.alerts)
         {
-			// Always clear because of nested allocations
-            OpenWeatherOneCall::freeAlertMem();
             //count alerts here
             int z = 0;
-            while(doc["alerts"][z] and (z<10)) z++ ;
+            while(doc["alerts"][z] and (z<alertCapacity)) z++ ;
 
             if(z > 0) // 
                 {
-                    MAX_NUM_ALERTS = z;
-                    alert = (struct ALERTS *)realloc(alert,z*sizeof(struct ALERTS));
+                    alert = (struct ALERTS *)OpenWeatherOneCall::allocate(z,sizeof(struct ALERTS));
                     if(alert == NULL) return 23;
+                    MAX_NUM_ALERTS = z;
 
-                    //Start for loop of maximum alerts here
                     for(int x = 0; x < z; x++)
                         {
-                            JsonObject ALERTS_0 = doc["alerts"][x];
-							alert[x].senderName = (char *)malloc(sizeof(char) * strlen(ALERTS_0["sender_name"])+1);
-							if(alert[x].senderName == NULL) return 23;
-							strncpy(alert[x].senderName,ALERTS_0["sender_name"],strlen(ALERTS_0["sender_name"])+1);
-
-							alert[x].event = (char *)malloc(sizeof(char) * strlen(ALERTS_0["event"])+1);
-							if(alert[x].event == NULL) return 23;
-							strncpy(alert[x].event,ALERTS_0["event"],strlen(ALERTS_0["event"])+1);
-
-							alert[x].summary = (char *)malloc(sizeof(char) * strlen(ALERTS_0["description"])+1);
-							if(alert[x].summary == NULL) return 23;
-							strncpy(alert[x].summary,ALERTS_0["description"],strlen(ALERTS_0["description"])+1);
-
-							long tempTime = ALERTS_0["start"];
-							alert[x].alertStart = tempTime;
-							tempTime += location.timezoneOffset;
-							dateTimeConversion(tempTime,alert[x].startInfo,USER_PARAM.OPEN_WEATHER_DATEFORMAT);
-
-							tempTime = ALERTS_0["end"];
-							alert[x].alertEnd = tempTime;
-							tempTime += location.timezoneOffset;
-							dateTimeConversion(tempTime,alert[x].endInfo,USER_PARAM.OPEN_WEATHER_DATEFORMAT);
-                        } //end for
+                            error_code = fillFields(map_alerts,&alert[x],doc["alerts"][x],fill);
+                            if(error_code) return error_code;
+                        }
                 }
         }
 
-
     if(exclude.hourly)
         {
             OpenWeatherOneCall::freeHourMem();
         }
-    else
+    else if(doc["hourly"])
         {
-            if(doc["hourly"])
+            if(!hour)
                 {
-                    if(!hour)
-                        {
-                            hour = (struct HOURLY *)calloc(48, sizeof(struct HOURLY));
-                            if(hour == NULL) return 23;
-                        }
-
-                    JsonArray hourly = doc["hourly"];
-                    for(int h = 0; h < 48; h++)
-                        {
-                            JsonObject hourly_0 = hourly[h];
-                            if (hourly_0) 
-                            {
-                                hour[h].dayTime = hourly_0["dt"]; // 1604336400
-                                hour[h].temperature = hourly_0["temp"]; // 46.58
-                                hour[h].apparentTemperature = hourly_0["feels_like"]; // 28.54
-                                hour[h].pressure = hourly_0["pressure"]; // 1015
-                                hour[h].humidity = hourly_0["humidity"]; // 31
-                                hour[h].dewPoint = hourly_0["dew_point"]; // 19.2
-                                hour[h].cloudCover = hourly_0["clouds"]; // 20
-                                hour[h].visibility = hourly_0["visibility"]; // 10000
-                                hour[h].windSpeed = hourly_0["wind_speed"]; // 22.77
-                                hour[h].windBearing = hourly_0["wind_deg"]; // 300
-                            }
-                            if(hourly_0["snow"]["1h"])
-                                {
-                                    hour[h].snowVolume = hourly_0["snow"]["1h"]; // 95
-									if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                                        {
-                                            hour[h].snowVolume /= 25.4; // to inch
-                                        } 
-                                } else hour[h].snowVolume = 0;
-
-                            if(hourly_0["rain"]["1h"]) 
-                                {
-                                    hour[h].rainVolume = hourly_0["rain"]["1h"]; // checked need 1h
-									if(USER_PARAM.OPEN_WEATHER_UNITS == IMPERIAL)
-                                        {
-                                            hour[h].rainVolume /= 25.4; // inch
-                                        }
-                                } else hour[h].rainVolume = 0;
-
-
-                            JsonObject hourly_0_weather_0 = hourly_0["weather"][0];
-                            hour[h].id = hourly_0_weather_0["id"]; // 801
-                            if(hourly_0_weather_0["main"])
-                                {
-                                    hour[h].main = (char *)realloc(hour[h].main,sizeof(char) * strlen(hourly_0_weather_0["main"])+2);
-                                    if(hour[h].main == NULL) return 23;
-                                    strncpy(hour[h].main,hourly_0_weather_0["main"],strlen(hourly_0_weather_0["main"])+1);
-                                }
-
-                            if(hourly_0_weather_0["description"])
-                                {
-                                    hour[h].summary = (char *)realloc(hour[h].summary,sizeof(char) * strlen(hourly_0_weather_0["description"])+2);
-                                    if(hour[h].summary == NULL) return 23;
-                                    strncpy(hour[h].summary,hourly_0_weather_0["description"],strlen(hourly_0_weather_0["description"])+1);
-                                }
+                    hour = (struct HOURLY *)OpenWeatherOneCall::allocate(NUM_HOURS, sizeof(struct HOURLY));
+                    if(hour == NULL) return 23;
+                }
 
-                            strncpy(hour[h].icon,hourly_0_weather_0["icon"],strlen(hourly_0_weather_0["icon"])+1);
+            error_code = fillArray(map_hourly,hour,sizeof(struct HOURLY),NUM_HOURS,doc["hourly"],fill);
+            if(error_code) return error_code;
+        }
 
-                            hour[h].pop = hourly_0["pop"]; // 0
-                        }
+    if(exclude.minutely)
+        {
+            OpenWeatherOneCall::freeMinuteMem();
+        }
+    else if(doc["minutely"])
+        {
+            if(!minute)
+                {
+                    minute = (struct MINUTELY *)OpenWeatherOneCall::allocate(NUM_MINUTES, sizeof(struct MINUTELY));
+                    if(minute == NULL) return 23;
                 }
+
+            error_code = fillArray(map_minutely,minute,sizeof(struct MINUTELY),NUM_MINUTES,doc["minutely"],fill);
+            if(error_code) return error_code;
         }
 
+    OpenWeatherOneCall::formatOneCallDates();
+    return OpenWeatherOneCall::fillSeries();
+}
 
-    if(exclude.minutely)
+// Readable dates for current, forecast and alerts, after either parser
+void OpenWeatherOneCall::formatOneCallDates(void)
+{
+#ifndef OWOC_LAZY_DATES
+    if(current)
         {
-            OpenWeatherOneCall::freeMinuteMem();
+            if(current->dayTime)
+                {
+                    dateTimeConversion(current->dayTime + location.timezoneOffset,current->readableDateTime,sizeof(current->readableDateTime),USER_PARAM.OPEN_WEATHER_DATEFORMAT);
+                    dateTimeConversion(current->dayTime + location.timezoneOffset,current->readableWeekdayName,sizeof(current->readableWeekdayName),9);
+                }
+            if(current->sunriseTime)
+                {
+                    dateTimeConversion(current->sunriseTime + location.timezoneOffset,current->readableSunrise,sizeof(current->readableSunrise),USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
+                }
+            if(current->sunsetTime)
+                {
+                    dateTimeConversion(current->sunsetTime + location.timezoneOffset,current->readableSunset,sizeof(current->readableSunset),USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
+                }
         }
-    else
+
+    if(forecast)
         {
-            if(doc["minutely"])
+            for(int x = 0; x < NUM_DAYS; x++)
                 {
-                    if(!minute)
+                    if(forecast[x].dayTime)
                         {
-                            minute = (struct MINUTELY *)calloc(61, sizeof(struct MINUTELY));
-                            if(minute == NULL) return 23;
+                            dateTimeConversion(forecast[x].dayTime + location.timezoneOffset,FORECAST_TEXT(x).readableDateTime,sizeof(FORECAST_TEXT(x).readableDateTime),USER_PARAM.OPEN_WEATHER_DATEFORMAT);
                         }
-
-                    JsonArray minutely = doc["minutely"];
-
-                    for(int x = 0; x<61; x++)
+                    if(forecast[x].sunriseTime)
+                        {
+                            dateTimeConversion(forecast[x].sunriseTime + location.timezoneOffset,FORECAST_TEXT(x).readableSunrise,sizeof(FORECAST_TEXT(x).readableSunrise),USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
+                        }
+                    if(forecast[x].sunsetTime)
                         {
-                            minute[x].dayTime = minutely[x]["dt"];
-                            minute[x].precipitation = minutely[x]["precipitation"]; // 0
+                            dateTimeConversion(forecast[x].sunsetTime + location.timezoneOffset,FORECAST_TEXT(x).readableSunset,sizeof(FORECAST_TEXT(x).readableSunset),USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
                         }
+                    dateTimeConversion(forecast[x].dayTime,FORECAST_TEXT(x).weekDayName,sizeof(FORECAST_TEXT(x).weekDayName),9);
                 }
         }
 
-    return 0;
+    for(int x = 0; alert && (x < MAX_NUM_ALERTS); x++)
+        {
+            dateTimeConversion(alert[x].alertStart + location.timezoneOffset,alert[x].startInfo,sizeof(alert[x].startInfo),USER_PARAM.OPEN_WEATHER_DATEFORMAT);
+            dateTimeConversion(alert[x].alertEnd + location.timezoneOffset,alert[x].endInfo,sizeof(alert[x].endInfo),USER_PARAM.OPEN_WEATHER_DATEFORMAT);
+        }
+#endif
+}
+
+// "" for an epoch that was not in the response
+const char *OpenWeatherOneCall::formatDate(long _EPOCH, int _FORMAT)
+{
+    if(_EPOCH == 0) return "";
+
+    long local = _EPOCH + location.timezoneOffset;
+    for(int d = 0; d < DATE_CACHE_SIZE; d++)
+        {
+            if((dateCache[d].format == _FORMAT) && (dateCache[d].epoch == local)) return dateCache[d].text;
+        }
+
+    struct dateText &slot = dateCache[dateNext];
+    dateNext = (dateNext + 1) % DATE_CACHE_SIZE;
+    slot.epoch = local;
+    slot.format = _FORMAT;
+    dateTimeConversion(local,slot.text,sizeof(slot.text),_FORMAT);
+    return slot.text;
+}
+
+const char *OpenWeatherOneCall::readableDateTime(long _EPOCH)
+{
+    return OpenWeatherOneCall::formatDate(_EPOCH,USER_PARAM.OPEN_WEATHER_DATEFORMAT);
+}
+
+const char *OpenWeatherOneCall::readableTime(long _EPOCH)
+{
+    return OpenWeatherOneCall::formatDate(_EPOCH,USER_PARAM.OPEN_WEATHER_DATEFORMAT+4);
+}
+
+const char *OpenWeatherOneCall::readableWeekday(long _EPOCH)
+{
+    return OpenWeatherOneCall::formatDate(_EPOCH,9);
+}
+
+// One Call section names in EXCL_ bit order
+static const char *const excludeNames[] = {"current","daily","hourly","minutely","alerts"};
+
+// "&exclude=..." for the sections the server should leave out, "" for none
+void OpenWeatherOneCall::buildExcludeQuery(char *query)
+{
+    query[0] = '\0';
+    for(size_t x = 0; x < SIZEOF(excludeNames); x++)
+        {
+            if(!(exclude.all_excludes & (1 << x))) continue;
+            strcat(query,query[0] ? "," : EXCLUDE_PARAM);
+            strcat(query,excludeNames[x]);
+        }
+}
+
+// Filter for the One Call body: skip excluded sections and unused members
+// A filter keeps every element of an array, so a shorter setHorizon() is cut after the parse
+void OpenWeatherOneCall::buildOneCallFilter(JsonDocument &filter)
+{
+    char filterJson[sizeof(filter_onecall_head) + sizeof(filter_onecall_current) + sizeof(filter_onecall_daily) +
+                    sizeof(filter_onecall_hourly) + sizeof(filter_onecall_minutely) + sizeof(filter_onecall_alerts)];
+
+    strcpy(filterJson,filter_onecall_head);
+    if(!exclude.current)  strcat(filterJson,filter_onecall_current);
+    if(!exclude.daily)    strcat(filterJson,filter_onecall_daily);
+    if(!exclude.hourly)   strcat(filterJson,filter_onecall_hourly);
+    if(!exclude.minutely) strcat(filterJson,filter_onecall_minutely);
+    if(!exclude.alerts)   strcat(filterJson,filter_onecall_alerts);
+    strcat(filterJson,"}");
+
+    deserializeJson(filter,filterJson);
 }
 
 int OpenWeatherOneCall::setOpenWeatherKey(char* owKey)
@@ -1076,13 +1004,15 @@ int OpenWeatherOneCall::setOpenWeatherKey(char* owKey)
 
 int OpenWeatherOneCall::setExcl(int _EXCL)
 {
-    if((_EXCL > 31) || (_EXCL <= 0))
+    if((_EXCL > 63) || (_EXCL <= 0))
         {
             USER_PARAM.OPEN_WEATHER_EXCLUDES = 0;
+            exclude.all_excludes = OpenWeatherOneCall::horizonExcludes();
             return 14;
         }
     else
         USER_PARAM.OPEN_WEATHER_EXCLUDES = _EXCL;
+    exclude.all_excludes = USER_PARAM.OPEN_WEATHER_EXCLUDES | OpenWeatherOneCall::horizonExcludes(); // Bitfield follows the EXCL_ values
 
     return 0;
 }
@@ -1132,42 +1062,359 @@ int OpenWeatherOneCall::setDateTimeFormat(int _DTF)
     return 0;
 }
 
+int OpenWeatherOneCall::setArena(void *buffer, size_t size)
+{
+    if(storageFixed) return 37;
+    if(snapshotMode == SNAPSHOT_ON) return (buffer && size) ? 34 : 0;
+    OpenWeatherOneCall::resetArena();
+    arenaFit = false;
+    return arena.begin(buffer,size);
+}
+
+int OpenWeatherOneCall::setArena(size_t size)
+{
+    if(storageFixed) return 37;
+    if(snapshotMode == SNAPSHOT_ON) return size ? 34 : 0;
+    OpenWeatherOneCall::resetArena();
+    arenaFit = false;
+    return arena.begin(size);
+}
+
+// Sized from the excludes, horizon, history and series settings; a refresh
+// regrows the block when one of them changed since
+int OpenWeatherOneCall::setArena(void)
+{
+    int error_code = OpenWeatherOneCall::setArena(OpenWeatherOneCall::getArenaSize());
+    if(error_code) return error_code;
+    arenaFit = true;
+    return 0;
+}
+
+// Every block one refresh allocates, text for all entries in another language included
+size_t OpenWeatherOneCall::getArenaSize(void)
+{
+    if(USER_PARAM.OPEN_WEATHER_HISTORY)
+        {
+#ifdef OWOC_SPLIT_RECORDS
+            return ARENA_BLOCK(sizeof(HISTORICAL)) + ARENA_BLOCK(sizeof(recordText)) + 3 * ARENA_BLOCK(ARENA_ENTRY_TEXT);
+#else
+            return ARENA_BLOCK(sizeof(HISTORICAL)) + 3 * ARENA_BLOCK(ARENA_ENTRY_TEXT);
+#endif
+        }
+
+    size_t size = 0;
+    int entries = 0;
+    if(!exclude.current)
+        {
+            size += ARENA_BLOCK(sizeof(nowData));
+            entries++;
+        }
+    if(!exclude.daily)
+        {
+            size += ARENA_BLOCK(NUM_DAYS * sizeof(futureData));
+#ifdef OWOC_SPLIT_RECORDS
+            size += ARENA_BLOCK(NUM_DAYS * sizeof(recordText));
+#endif
+            entries += NUM_DAYS;
+        }
+    if(!exclude.hourly)
+        {
+            size += ARENA_BLOCK(NUM_HOURS * sizeof(HOURLY));
+            entries += NUM_HOURS;
+        }
+    if(!exclude.minutely) size += ARENA_BLOCK(NUM_MINUTES * sizeof(MINUTELY));
+    if(!exclude.alerts) size += ARENA_BLOCK(alertCapacity * sizeof(ALERTS)) + alertCapacity * ARENA_ALERT_TEXT;
+    if(!exclude.quality) size += ARENA_BLOCK(sizeof(airQuality));
+    if(seriesMode == SERIES_ON) size += ARENA_BLOCK(sizeof(WeatherSeries));
+
+    // main, summary and icon are three blocks each
+    return size + entries * 3 * ARENA_BLOCK(ARENA_ENTRY_TEXT);
+}
+
+int OpenWeatherOneCall::setStorage(void *buffer, size_t size, int days, int hours, int minutes, int alerts)
+{
+    int error_code = OpenWeatherOneCall::setArena(buffer,size);
+    if(error_code) return error_code;
+
+    dayCapacity = NUM_DAYS = days;
+    hourCapacity = NUM_HOURS = hours;
+    minuteCapacity = NUM_MINUTES = minutes;
+    alertCapacity = alerts;
+    exclude.all_excludes = USER_PARAM.OPEN_WEATHER_EXCLUDES | OpenWeatherOneCall::horizonExcludes();
+    storageFixed = true;
+    return 0;
+}
+
+int OpenWeatherOneCall::setHorizon(int _DAYS, int _HOURS, int _MINUTES)
+{
+    if((_DAYS < 0) || (_DAYS > dayCapacity) || (_HOURS < 0) || (_HOURS > hourCapacity) || (_MINUTES < 0) || (_MINUTES > minuteCapacity)) return 38;
+    if(asyncBusy) return 28;
+    if((_DAYS == NUM_DAYS) && (_HOURS == NUM_HOURS) && (_MINUTES == NUM_MINUTES)) return 0;
+    if(snapshotMode == SNAPSHOT_ON) return 39; // readers may still be on the published arrays
+
+    // The arrays are sized for the old horizon
+    OpenWeatherOneCall::resetArena();
+    cacheValid = false;
+
+    NUM_DAYS = _DAYS;
+    NUM_HOURS = _HOURS;
+    NUM_MINUTES = _MINUTES;
+    exclude.all_excludes = USER_PARAM.OPEN_WEATHER_EXCLUDES | OpenWeatherOneCall::horizonExcludes();
+    return 0;
+}
+
+// Sections with no entries are left out of the request like an exclude
+int OpenWeatherOneCall::horizonExcludes(void)
+{
+    return (NUM_DAYS ? 0 : EXCL_D) | (NUM_HOURS ? 0 : EXCL_H) | (NUM_MINUTES ? 0 : EXCL_M) | (alertCapacity ? 0 : EXCL_A);
+}
+
+size_t OpenWeatherOneCall::getArenaUsed(void)
+{
+    return arena.peak();
+}
+
+int OpenWeatherOneCall::setParser(int _PARSER)
+{
+    if((_PARSER != DOM_PARSER) && (_PARSER != STREAM_PARSER))
+        return 27;
+    USER_PARAM.OPEN_WEATHER_PARSER = _PARSER;
+    return 0;
+}
+
+int OpenWeatherOneCall::setLocationPrecision(int _DECIMALS)
+{
+    return locations->setPrecision(_DECIMALS);
+}
+
+void OpenWeatherOneCall::setLocationCache(LocationCache *shared)
+{
+    locations = shared ? shared : &ownLocations;
+}
+
+LocationCache *OpenWeatherOneCall::getLocationCache(void)
+{
+    return locations;
+}
+
+int OpenWeatherOneCall::setReverseGeocode(int _MODE)
+{
+    if(_MODE != GEOCODE_ONLINE)
+        return 33;
+    reverseGeocode = _MODE;
+    return 0;
+}
+
+int OpenWeatherOneCall::setSeries(int _MODE)
+{
+    if((_MODE != SERIES_OFF) && (_MODE != SERIES_ON))
+        return 36;
+    seriesMode = _MODE;
+    return 0;
+}
+
+// hour and minute as arrays, after the parse and the readable dates
+int OpenWeatherOneCall::fillSeries(void)
+{
+    if((seriesMode == SERIES_OFF) || (!hour && !minute))
+        {
+            OpenWeatherOneCall::freeSeriesMem();
+            return 0;
+        }
+
+    if(!series)
+        {
+            series = (struct WeatherSeries *)OpenWeatherOneCall::allocate(1,sizeof(struct WeatherSeries));
+            if(series == NULL) return 23;
+        }
+
+    series->hours = hour ? NUM_HOURS : 0;
+    series->hourStart = hour ? hour[0].dayTime : 0;
+    for(int h = 0; h < series->hours; h++)
+        {
+            series->temperature[h] = WEATHER_FLOAT(hour[h].temperature);
+            series->apparentTemperature[h] = WEATHER_FLOAT(hour[h].apparentTemperature);
+            series->pop[h] = WEATHER_FLOAT(hour[h].pop);
+            series->rainVolume[h] = WEATHER_FLOAT(hour[h].rainVolume);
+            series->snowVolume[h] = WEATHER_FLOAT(hour[h].snowVolume);
+            series->windSpeed[h] = WEATHER_FLOAT(hour[h].windSpeed);
+            series->pressure[h] = hour[h].pressure;
+            series->humidity[h] = hour[h].humidity;
+            series->cloudCover[h] = hour[h].cloudCover;
+        }
+
+    series->minutes = minute ? NUM_MINUTES : 0;
+    series->minuteStart = minute ? minute[0].dayTime : 0;
+    for(int m = 0; m < series->minutes; m++) series->precipitation[m] = WEATHER_FLOAT(minute[m].precipitation);
+    return 0;
+}
+
+int OpenWeatherOneCall::setFetchMode(int _MODE)
+{
+    if((_MODE != SEQUENTIAL_FETCH) && (_MODE != CONCURRENT_FETCH))
+        return 29;
+    USER_PARAM.OPEN_WEATHER_FETCH = _MODE;
+    return 0;
+}
+
+int OpenWeatherOneCall::setKeepAlive(long _IDLE_MS)
+{
+    session.setIdle(_IDLE_MS);
+    aqSession.setIdle(_IDLE_MS);
+    return 0;
+}
+
 // free routines
 
+// Result blocks come from the arena when one is set, else from the heap
+void *OpenWeatherOneCall::allocate(size_t count, size_t size)
+{
+    if(arena.active()) return arena.calloc(count,size);
+    return calloc(count,size);
+}
+
+void *OpenWeatherOneCall::reallocate(void *block, size_t oldSize, size_t size)
+{
+    if(arena.active()) return arena.reallocate(block,oldSize,size);
+    return realloc(block,size);
+}
+
+void OpenWeatherOneCall::release(void *block)
+{
+    if(block && !arena.owns(block)) free(block);
+}
+
+// Drop every result. With an arena everything lives in it, so this is O(1)
+void OpenWeatherOneCall::resetArena(void)
+{
+    if(arena.active())
+        {
+            current = NULL;
+            forecast = NULL;
+#ifdef OWOC_SPLIT_RECORDS
+            forecastText = NULL;
+            historyText = NULL;
+#endif
+            hour = NULL;
+            minute = NULL;
+            series = NULL;
+            alert = NULL;
+            history = NULL;
+            quality = NULL;
+            MAX_NUM_ALERTS = 0;
+            arena.reset();
+            return;
+        }
+
+    OpenWeatherOneCall::freeResultMem();
+}
+
+void OpenWeatherOneCall::freeResultMem(void)
+{
+    OpenWeatherOneCall::freeCurrentMem();
+    OpenWeatherOneCall::freeForecastMem();
+    OpenWeatherOneCall::freeAlertMem();
+    OpenWeatherOneCall::freeHourMem();
+    OpenWeatherOneCall::freeMinuteMem();
+    OpenWeatherOneCall::freeSeriesMem();
+    OpenWeatherOneCall::freeHistoryMem();
+    OpenWeatherOneCall::freeQualityMem();
+}
+
 void OpenWeatherOneCall::freeCurrentMem(void)
 {
     if(current)
         {
-            if(current->summary) free(current->summary);
-            if(current->main)     free(current->main);
-            free(current);
+            freeConditionText(current->summary,&arena);
+            freeConditionText(current->main,&arena);
+            freeConditionText(current->icon,&arena);
+            OpenWeatherOneCall::release(current);
             current = NULL;
         }
 }
 
+// forecast (and forecastText) when missing; daily is set up to fill them
+int OpenWeatherOneCall::allocateForecast(FillOptions &daily)
+{
+    if(!forecast)
+        {
+            forecast = (struct futureData *)OpenWeatherOneCall::allocate(NUM_DAYS,sizeof(struct futureData));
+            if(forecast == NULL) return 23;
+        }
+#ifdef OWOC_SPLIT_RECORDS
+    if(!forecastText)
+        {
+            forecastText = (struct recordText *)OpenWeatherOneCall::allocate(NUM_DAYS,sizeof(struct recordText));
+            if(forecastText == NULL) return 23;
+        }
+    daily.cold = forecastText;
+    daily.coldSize = sizeof(struct recordText);
+#else
+    (void)daily; // the records hold their own text
+#endif
+    return 0;
+}
+
 void OpenWeatherOneCall::freeForecastMem(void)
 {
+#ifdef OWOC_SPLIT_RECORDS
+    if(forecastText)
+        {
+            for( int x = NUM_DAYS; x > 0; x--)
+                {
+                    freeConditionText(forecastText[x-1].summary,&arena);
+                    freeConditionText(forecastText[x-1].main,&arena);
+                    freeConditionText(forecastText[x-1].icon,&arena);
+                }
+            OpenWeatherOneCall::release(forecastText);
+            forecastText = NULL;
+        }
+    if(forecast)
+        {
+            OpenWeatherOneCall::release(forecast);
+            forecast = NULL;
+        }
+#else
     if(forecast)
         {
-            for( int x = 8; x > 0; x--)
+            for( int x = NUM_DAYS; x > 0; x--)
                 {
-                    if (forecast[x-1].summary) free(forecast[x-1].summary);
-                    if (forecast[x-1].main)    free(forecast[x-1].main);
+                    freeConditionText(forecast[x-1].summary,&arena);
+                    freeConditionText(forecast[x-1].main,&arena);
+                    freeConditionText(forecast[x-1].icon,&arena);
                 }
-            free(forecast);
+            OpenWeatherOneCall::release(forecast);
             forecast = NULL;
         }
+#endif
 }
 
 void OpenWeatherOneCall::freeHistoryMem(void)
 {
+#ifdef OWOC_SPLIT_RECORDS
+    if(historyText)
+        {
+            freeConditionText(historyText[0].summary,&arena);
+            freeConditionText(historyText[0].main,&arena);
+            freeConditionText(historyText[0].icon,&arena);
+            OpenWeatherOneCall::release(historyText);
+            historyText = NULL;
+        }
     if(history)
         {
-			if (history[0].summary) free(history[0].summary);
-			if (history[0].main);   free(history[0].main);
-            free(history);
+            OpenWeatherOneCall::release(history);
             history = NULL;
         }
+#else
+    if(history)
+        {
+			freeConditionText(history[0].summary,&arena);
+			freeConditionText(history[0].main,&arena);
+			freeConditionText(history[0].icon,&arena);
+            OpenWeatherOneCall::release(history);
+            history = NULL;
+        }
+#endif
 }
 
 void OpenWeatherOneCall::freeAlertMem(void)
@@ -1176,11 +1423,11 @@ void OpenWeatherOneCall::freeAlertMem(void)
         {
             for( int x = MAX_NUM_ALERTS; x > 0; x--)
                 {    // Free all char pointers
-                    if (alert[x-1].senderName)     free(alert[x-1].senderName);
-                    if (alert[x-1].event)         free(alert[x-1].event);
-                    if (alert[x-1].summary)        free(alert[x-1].summary);
+                    OpenWeatherOneCall::release(alert[x-1].senderName);
+                    OpenWeatherOneCall::release(alert[x-1].event);
+                    OpenWeatherOneCall::release(alert[x-1].summary);
                 }
-            free(alert);
+            OpenWeatherOneCall::release(alert);
             alert = NULL;
         }
     MAX_NUM_ALERTS = 0 ;
@@ -1190,12 +1437,13 @@ void OpenWeatherOneCall::freeHourMem(void)
 {
     if(hour)
         {
-            for( int x = 48; x > 0; x--)
+            for( int x = NUM_HOURS; x > 0; x--)
                 {
-                    if (hour[x-1].summary) free(hour[x-1].summary);
-                    if (hour[x-1].main)    free(hour[x-1].main);
+                    freeConditionText(hour[x-1].summary,&arena);
+                    freeConditionText(hour[x-1].main,&arena);
+                    freeConditionText(hour[x-1].icon,&arena);
                 }
-            free(hour);
+            OpenWeatherOneCall::release(hour);
             hour = NULL;
         }
 }
@@ -1204,16 +1452,25 @@ void OpenWeatherOneCall::freeMinuteMem(void)
 {
     if(minute)
         {
-            free(minute);
+            OpenWeatherOneCall::release(minute);
             minute = NULL;
         }
 }
 
+void OpenWeatherOneCall::freeSeriesMem(void)
+{
+    if(series)
+        {
+            OpenWeatherOneCall::release(series);
+            series = NULL;
+        }
+}
+
 void OpenWeatherOneCall::freeQualityMem(void)
 {
     if(quality)
         {
-            free(quality);
+            OpenWeatherOneCall::release(quality);
             quality = NULL;
         }
 }
@@ -1229,13 +1486,12 @@ char* OpenWeatherOneCall::getErrorMsgs(int _errMsg)
 
 OpenWeatherOneCall::~OpenWeatherOneCall()
 {
-    OpenWeatherOneCall::freeCurrentMem();
-    OpenWeatherOneCall::freeForecastMem();
-    OpenWeatherOneCall::freeAlertMem();
-    OpenWeatherOneCall::freeHourMem();
-    OpenWeatherOneCall::freeMinuteMem();
-    OpenWeatherOneCall::freeHistoryMem();
-    OpenWeatherOneCall::freeQualityMem();
+    // A running refresh still writes into this object
+    while(asyncBusy) delay(10);
+
+    OpenWeatherOneCall::freeResultMem();
+    cacheStale = 0; // a stale window keeps SNAPSHOT_ON
+    OpenWeatherOneCall::setSnapshots(SNAPSHOT_OFF); // frees the spare set
 }
 
 // Allow application to use it's own Epochtime
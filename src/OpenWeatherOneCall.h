@@ -19,8 +19,18 @@
 #include <time.h>
 #include <Arduino.h>
 #include <string.h>
+#include <atomic>
 #include "errMsgs.h"
+#include "OpenWeatherArena.h"
+#include "OpenWeatherSession.h"
+#include "LocationCache.h"
+#include "WeatherSeries.h"
 #include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+class JsonStreamReader;
+struct FillOptions;
 
 // Excludes
 #define EXCL_C 1  //Exclude Current
@@ -28,6 +38,7 @@
 #define EXCL_H 4  //Exclude Hourly
 #define EXCL_M 8  //Exclude Minutely
 #define EXCL_A 16 //Exclude Alerts
+#define EXCL_Q 32 //Exclude air Quality, no air pollution request
 
 //UNITS
 #define METRIC 1
@@ -40,6 +51,74 @@
 #define MDY12H 3
 #define DMY12H 4
 
+//Parsers
+#define DOM_PARSER 1    // JsonDocument, default
+#define STREAM_PARSER 2 // One Call streamed into the structs, no document
+
+//parseWeatherAsync()
+#define ASYNC_RUNNING -1   // getAsyncResult() until the refresh has finished
+#define ASYNC_STACK 8192   // Same as the Arduino loop task, TLS needs most of it
+#define ASYNC_PRIORITY 1
+
+//Response cache, getCacheStatus()
+#define CACHE_MISS 0  // Fetched from the network
+#define CACHE_FRESH 1 // Last results, younger than the TTL
+#define CACHE_STALE 2 // Last results, a background refresh is running
+
+//Result snapshots, setSnapshots()
+#define SNAPSHOT_OFF 0 // A refresh writes the results in place, default
+#define SNAPSHOT_ON 1  // A refresh fills a second set and publishes it when complete
+
+//Hourly/minutely arrays, setSeries()
+#define SERIES_OFF 0 // default
+#define SERIES_ON 1  // hour and minute copied into series after every parse
+
+//setArena(void), text a refresh may copy to the arena
+#define ARENA_ENTRY_TEXT 64   // one main, summary or icon not in the condition tables
+#define ARENA_ALERT_TEXT 4096 // sender, event and description of one alert
+
+//Result arrays, at most what One Call returns. OpenWeatherOneCallT sizes them at compile time
+#define ONECALL_DAYS 8
+#define ONECALL_HOURS 48
+#define ONECALL_MINUTES 61
+#define ONECALL_ALERTS 10
+
+//Readable dates formatted on demand, readableDateTime()
+#define DATE_CACHE_SIZE 8 // Strings kept at once, the oldest is reused
+
+//Weather values, float unless built with OWOC_FIXED_POINT (no FPU, ESP32-C3)
+#ifdef OWOC_FIXED_POINT
+#define FIXED_DECIMALS 2
+#define FIXED_SCALE 100           // 10^FIXED_DECIMALS
+typedef int16_t weather_whole_t;  // id, humidity, clouds, pressure, wind_deg, visibility
+typedef int16_t weather_small_t;  // wind speed and gust, uvi, pop in 1/100
+typedef int32_t weather_fixed_t;  // temperatures, dew point, rain and snow in 1/100
+#define WEATHER_FLOAT(x) ((float)(x) / FIXED_SCALE) // weather_small_t, weather_fixed_t
+#else
+typedef float weather_whole_t;
+typedef float weather_small_t;
+typedef float weather_fixed_t;
+#define WEATHER_FLOAT(x) (x)
+#endif
+
+//Forecast and history text in forecastText/historyText, built with OWOC_SPLIT_RECORDS.
+//Upper bounds of the numbers-only records: 4 cache lines of the ESP32, 2 on x86-64.
+//Not alignas(cache line): arena blocks are ARENA_ALIGN and the ESP32 heap aligns to less
+#define FORECAST_RECORD_BYTES 128
+#define HISTORY_RECORD_BYTES 128
+
+//Reverse geocode, getLocationInfo()
+#define GEOCODE_ONLINE 0  // api.bigdatacloud.net, default; no offline mode until a city table with names ships
+
+//IP location, setLatLon(void)
+#define IP_ONE_STEP 1        // ipapi.co finds the caller's address itself, default
+#define IP_TWO_STEP 2        // ipify for the address, then ipapi.co for it
+#define IP_LOCATION_TTL 3600 // Seconds the result is reused, default
+
+//Fetch modes
+#define SEQUENTIAL_FETCH 0 // Air quality, then One Call, default
+#define CONCURRENT_FETCH 1 // Air quality on a task on the other core, own connection
+
 //struct initializer
 #define NEW_API {"",0.0f,0.0f,true,0,0,0}
 
@@ -51,6 +130,26 @@ public:
 
     //Methods
     int parseWeather(void);
+    // Refresh on its own task, 0 when started. Leave the results alone until it has finished.
+    int parseWeatherAsync(std::function<void(int)> callable = NULL);
+    bool isRefreshing(void);
+    // Results from another task without a lock, see OpenWeatherSnapshot.cpp
+    int setSnapshots(int _MODE);
+    int setSeries(int _MODE);
+    // A 0 leaves the section out of the request. Under DOM_PARSER the JsonDocument still holds
+    // every entry of a shorter horizon; only STREAM_PARSER drops them while reading
+    int setHorizon(int _DAYS, int _HOURS, int _MINUTES); // Entries kept of daily, hourly, minutely; 0 leaves it out
+    int getAsyncResult(void);
+    // Serve the last results for ttl seconds, then up to stale seconds more while refreshing.
+    // A stale window turns on SNAPSHOT_ON: while isRefreshing(), read through readSnapshot()
+    int setCache(unsigned long _TTL_S, unsigned long _STALE_S);
+    int getCacheStatus(void);
+    // Reverse geocode cache, see LocationCache.h
+    int setLocationPrecision(int _DECIMALS);
+    void setLocationCache(LocationCache *shared); // NULL: this instance's own
+    LocationCache *getLocationCache(void);
+    int setReverseGeocode(int _MODE);
+    int setIPLocationMode(int _MODE, unsigned long _TTL_S = IP_LOCATION_TTL);
 
     void initAPI(void);
     int setOpenWeatherKey(char* owKey);
@@ -61,6 +160,20 @@ public:
     int setUnits(int _UNIT);
     int setHistory(int _HIS);
     int setDateTimeFormat(int _DTF);
+    // Text for an epoch of the last refresh, timezone offset added. Formatted
+    // on first use, valid until DATE_CACHE_SIZE other strings have been made.
+    // With OWOC_LAZY_DATES these replace the readable fields in the structs.
+    const char *readableDateTime(long _EPOCH); // setDateTimeFormat()
+    const char *readableTime(long _EPOCH);     // time only, as sunrise/sunset
+    const char *readableWeekday(long _EPOCH);  // "Mon"
+    int setParser(int _PARSER);
+    int setArena(void *buffer, size_t size); // Results in the caller's buffer, NULL turns it off
+    int setArena(size_t size);               // Results in one internal block
+    int setArena(void);                      // One internal block of getArenaSize(), grown when that does
+    size_t getArenaSize(void);               // Bytes a refresh with the current settings can take
+    size_t getArenaUsed(void);               // Peak bytes a refresh needed
+    int setFetchMode(int _MODE);
+    int setKeepAlive(long _IDLE_MS);         // KEEPALIVE_OFF, KEEPALIVE_REFRESH or idle ms between refreshes
     char* getErrorMsgs(int errorMsg);
     char* nextLanguage(char* shrtPtr, char* lngPtr, int _langNum);
     char* setLanguage(char* shortPtr);
@@ -90,7 +203,9 @@ public:
     struct airQuality
     {
         long dayTime;
+#ifndef OWOC_LAZY_DATES
         char readableDateTime[20];
+#endif
         int aqi;
         float co; // :201.94053649902344,
         float no; //:0.01877197064459324,
@@ -105,72 +220,88 @@ public:
     struct nowData
     {
         long dayTime; // 1582151288
+#ifndef OWOC_LAZY_DATES
         char readableDateTime[20];
         char readableWeekdayName[20];
+#endif
         long sunriseTime; // 1582112760
+#ifndef OWOC_LAZY_DATES
         char readableSunrise[20];
+#endif
         long sunsetTime; // 1582151880
+#ifndef OWOC_LAZY_DATES
         char readableSunset[20];
-        float temperature; // 46.38
-        float apparentTemperature; // 41.49
-        float pressure; // 1026.4
-        float humidity; // 0.31
-        float dewPoint; // 17.18
-        float uvIndex; // 0
-        float cloudCover; // 0.02
-        float visibility; // 10
-        float windSpeed; // 10.22
-        float windBearing; // 348
-        float windGust;
-        float snowVolume;
-        float rainVolume;
-        float id; //800
-        char* main; //"Clear"
-        char* summary; // "Clear Skies" - uses "description"
-        char icon[4]; // "02d"
+#endif
+        weather_fixed_t temperature; // 46.38
+        weather_fixed_t apparentTemperature; // 41.49
+        weather_whole_t pressure; // 1026.4
+        weather_whole_t humidity; // 0.31
+        weather_fixed_t dewPoint; // 17.18
+        weather_small_t uvIndex; // 0
+        weather_whole_t cloudCover; // 0.02
+        weather_whole_t visibility; // 10
+        weather_small_t windSpeed; // 10.22
+        weather_whole_t windBearing; // 348
+        weather_small_t windGust;
+        weather_fixed_t snowVolume;
+        weather_fixed_t rainVolume;
+        weather_whole_t id; //800
+        char* main; //"Clear" - read only, may point into the condition table
+        char* summary; // "Clear Skies" - uses "description", read only
+        char* icon; // "02d", read only
     } *current = NULL;
 
 
     struct futureData
     {
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
         char weekDayName[4];
+#endif
         long dayTime; // 1582088400
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
         char readableDateTime[20];
+#endif
         long sunriseTime; // 1582112760
-        char readableSunrise[5];
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
+        char readableSunrise[9]; // "hh:mm AM"
+#endif
         long sunsetTime; // 1582151880
-        char readableSunset[5];
-
-        float temperatureDay; // 51.24
-        float temperatureLow; // 30.17
-        float temperatureHigh; // 51.24
-        float temperatureNight; // 26.83
-        float temperatureEve;
-        float temperatureMorn;
-
-        float apparentTemperatureHigh; // 50.76
-        float apparentTemperatureLow; // 19.9
-        float apparentTemperatureEve; // 50.76
-        float apparentTemperatureMorn; // 19.9
-
-
-        float pressure; // 1024.1
-        float humidity; // 0.54
-        float dewPoint; // 26.79
-        float windSpeed; // 6.49
-        float windGust;
-        float windBearing; // 324
-
-        float id; //800
-        char* main; // "rain" this is main
-        char* summary; //description in json
-        char icon[4]; //"02d"
-
-        float cloudCover; // 0.53
-        float pop;
-        float rainVolume;
-        float snowVolume;
-        float uvIndex; // 3
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
+        char readableSunset[9]; // "hh:mm AM"
+#endif
+
+        weather_fixed_t temperatureDay; // 51.24
+        weather_fixed_t temperatureLow; // 30.17
+        weather_fixed_t temperatureHigh; // 51.24
+        weather_fixed_t temperatureNight; // 26.83
+        weather_fixed_t temperatureEve;
+        weather_fixed_t temperatureMorn;
+
+        weather_fixed_t apparentTemperatureHigh; // 50.76
+        weather_fixed_t apparentTemperatureLow; // 19.9
+        weather_fixed_t apparentTemperatureEve; // 50.76
+        weather_fixed_t apparentTemperatureMorn; // 19.9
+
+
+        weather_whole_t pressure; // 1024.1
+        weather_whole_t humidity; // 0.54
+        weather_fixed_t dewPoint; // 26.79
+        weather_small_t windSpeed; // 6.49
+        weather_small_t windGust;
+        weather_whole_t windBearing; // 324
+
+        weather_whole_t id; //800
+#ifndef OWOC_SPLIT_RECORDS
+        char* main; // "rain" this is main, read only
+        char* summary; //description in json, read only
+        char* icon; // "02d", read only
+#endif
+
+        weather_whole_t cloudCover; // 0.53
+        weather_small_t pop;
+        weather_fixed_t rainVolume;
+        weather_fixed_t snowVolume;
+        weather_small_t uvIndex; // 3
 
     } *forecast = NULL; //[8]
 
@@ -179,23 +310,23 @@ public:
     struct HOURLY
     {
         long dayTime; // 1604336400
-        float temperature; // 46.58
-        float apparentTemperature; // 28.54
-        float pressure; // 1015
-        float humidity; // 31
-        float dewPoint; // 19.2
-        float cloudCover; // 20
-        float visibility; // 10000
-        float windSpeed; // 22.77
-        float windBearing; // 300
-        float snowVolume;
-        float rainVolume;
-
-        float id; // 801
-        char* main; // "Clouds"
-        char* summary; // "few clouds"
-        char icon[4]; // "02d"
-        float pop; // 0
+        weather_fixed_t temperature; // 46.58
+        weather_fixed_t apparentTemperature; // 28.54
+        weather_whole_t pressure; // 1015
+        weather_whole_t humidity; // 31
+        weather_fixed_t dewPoint; // 19.2
+        weather_whole_t cloudCover; // 20
+        weather_whole_t visibility; // 10000
+        weather_small_t windSpeed; // 22.77
+        weather_whole_t windBearing; // 300
+        weather_fixed_t snowVolume;
+        weather_fixed_t rainVolume;
+
+        weather_whole_t id; // 801
+        char* main; // "Clouds", read only
+        char* summary; // "few clouds", read only
+        char* icon; // "02d", read only
+        weather_small_t pop; // 0
     } *hour = NULL; // 48 hour forecast
 
 
@@ -203,69 +334,139 @@ public:
     struct MINUTELY
     {
         long dayTime; // 1604341320
-        float precipitation; // 0
+        weather_fixed_t precipitation; // 0
     } *minute = NULL; //[61] minutes forecast
 
+    struct WeatherSeries *series = NULL; // SERIES_ON, one array per field
+
 
     struct ALERTS
     {
         char* senderName; //[30] = "No Alert"; // "NWS Philadelphia - Mount Holly (New Jersey, Delaware, Southeastern Pennsylvania)"
         char* event; //[50] = "No Event"; // "Gale Watch"
         long alertStart; // 1604271600
+#ifndef OWOC_LAZY_DATES
         char startInfo[20];
+#endif
         long alertEnd;
+#ifndef OWOC_LAZY_DATES
         char endInfo[20];
+#endif
         char *summary;
     } *alert = NULL;
 
 
     struct HISTORICAL
     {
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
         char weekDayName[4];
+#endif
         long dayTime; // 1604242490
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
         char readableDateTime[20];
+#endif
         long sunrise; // 1604230151
-        char readableSunrise[5];
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
+        char readableSunrise[9]; // "hh:mm AM"
+#endif
         long sunset; // 1604267932
-        char readableSunset[5];
-        float temperature; // 285.9
-        float apparentTemperature; // 283.42
-        float pressure; // 1016
-        float humidity; // 76
-        float dewPoint; // 281.78
-        float uvIndex; // 3.1
-        float cloudCover; // 90
-        float visibility; // 16093
-        float windSpeed; // 3.1
-        float windBearing; // 160
-        float windGust;
-        float rainVolume;
-        float snowVolume;
-        float id; // 804
-        char* main; // "Clouds"
-        char* summary; // "overcast clouds"
-        char icon[4]; // "04d"
-        float h12_cloudCover; // 90
-        float h12_humidity; // 76
-        float day_rainVolume;
-        float h12_pressure; // 1016
-        float min_temperature; // 285.9
-        float max_temperature; // 285.9
-        float h00_temperature; // 285.9
-        float h06_temperature; // 285.9
-        float h12_temperature; // 285.9
-        float h18_temperature; // 285.9
-        float max_windSpeed; // 3.1
-        float max_windBearing; // 160
+#if !defined(OWOC_LAZY_DATES) && !defined(OWOC_SPLIT_RECORDS)
+        char readableSunset[9]; // "hh:mm AM"
+#endif
+        weather_fixed_t temperature; // 285.9
+        weather_fixed_t apparentTemperature; // 283.42
+        weather_whole_t pressure; // 1016
+        weather_whole_t humidity; // 76
+        weather_fixed_t dewPoint; // 281.78
+        weather_small_t uvIndex; // 3.1
+        weather_whole_t cloudCover; // 90
+        weather_whole_t visibility; // 16093
+        weather_small_t windSpeed; // 3.1
+        weather_whole_t windBearing; // 160
+        weather_small_t windGust;
+        weather_fixed_t rainVolume;
+        weather_fixed_t snowVolume;
+        weather_whole_t id; // 804
+#ifndef OWOC_SPLIT_RECORDS
+        char* main; // "Clouds", read only
+        char* summary; // "overcast clouds", read only
+        char* icon; // "04d", read only
+#endif
+        weather_whole_t h12_cloudCover; // 90
+        weather_whole_t h12_humidity; // 76
+        weather_fixed_t day_rainVolume;
+        weather_whole_t h12_pressure; // 1016
+        weather_fixed_t min_temperature; // 285.9
+        weather_fixed_t max_temperature; // 285.9
+        weather_fixed_t h00_temperature; // 285.9
+        weather_fixed_t h06_temperature; // 285.9
+        weather_fixed_t h12_temperature; // 285.9
+        weather_fixed_t h18_temperature; // 285.9
+        weather_small_t max_windSpeed; // 3.1
+        weather_whole_t max_windBearing; // 160
 		} *history = NULL; //[25]
 
+#ifdef OWOC_SPLIT_RECORDS
+    // Text of a forecast or history entry, kept apart so the records above
+    // are numbers only and a scan over many of them reads nothing else
+    struct recordText
+    {
+#ifndef OWOC_LAZY_DATES
+        char weekDayName[4];
+        char readableDateTime[20];
+        char readableSunrise[9]; // "hh:mm AM"
+        char readableSunset[9];
+#endif
+        char* main; // read only
+        char* summary; // read only
+        char* icon; // read only
+    } *forecastText = NULL, *historyText = NULL; // forecastText[x] belongs to forecast[x]
+
+    static_assert(sizeof(futureData) <= FORECAST_RECORD_BYTES, "futureData is over its size budget");
+    static_assert(sizeof(HISTORICAL) <= HISTORY_RECORD_BYTES, "HISTORICAL is over its size budget");
+#endif
+
     const char* short_names[7] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
     char buffer[40];
     int MAX_NUM_ALERTS = 0;
+    // Entries in forecast, hour and minute, read only, setHorizon()
+    int NUM_DAYS = ONECALL_DAYS;
+    int NUM_HOURS = ONECALL_HOURS;
+    int NUM_MINUTES = ONECALL_MINUTES;
+
+    // One complete refresh, SNAPSHOT_ON
+    struct weatherSnapshot
+    {
+        struct nowData *current;
+        struct futureData *forecast;
+        struct HOURLY *hour;
+        struct MINUTELY *minute;
+        struct WeatherSeries *series;
+        struct ALERTS *alert;
+        int MAX_NUM_ALERTS;
+        struct airQuality *quality;
+        struct HISTORICAL *history;
+#ifdef OWOC_SPLIT_RECORDS
+        struct recordText *forecastText;
+        struct recordText *historyText;
+#endif
+    };
+    // Read the view, then check snapshotChanged(seq): true means read again. The view stays
+    // valid until that call, once per readSnapshot(); a refresh that would reuse it waits
+    unsigned long readSnapshot(struct weatherSnapshot &view);
+    bool snapshotChanged(unsigned long seq);
+
 
+protected:
+    // OpenWeatherOneCallT: array sizes fixed, every result in buffer, a size of 0 excludes the section
+    int setStorage(void *buffer, size_t size, int days, int hours, int minutes, int alerts);
 
 private:
 
+#ifdef OWOC_HOST_BUILD
+    friend struct OpenWeatherOneCallProbe; // Host benchmark drives the private parse paths
+#endif
+
     //Methods
 
     int parseCityCoordinates(char* CTY_URL);
@@ -274,18 +475,114 @@ private:
     int createHistory(void);
     int createCurrent();
     int getLocationInfo();
-    int createAQ();
+    int createAQ(OpenWeatherSession &link, int offset);
+    int createConcurrent(void);
+    void buildOneCallFilter(JsonDocument &filter);
+    void buildExcludeQuery(char *query);
+    void formatOneCallDates(void);
+    const char *formatDate(long _EPOCH, int _FORMAT);
+
+    // STREAM_PARSER, OneCallStreamParser.cpp
+    int parseOneCallStream(Stream &stream);
+    int streamAlerts(JsonStreamReader &json);
+
+    void *allocate(size_t count, size_t size);
+    void *reallocate(void *block, size_t oldSize, size_t size);
+    void release(void *block);
+    void resetArena(void);
 
     void freeCurrentMem(void);
+    int allocateForecast(FillOptions &daily);
     void freeForecastMem(void);
     void freeAlertMem(void);
     void freeHourMem(void);
     void freeMinuteMem(void);
+    void freeSeriesMem(void);
+    int fillSeries(void);
     void freeHistoryMem(void);
     void freeQualityMem(void);
+    void freeResultMem(void);
+
+    // SNAPSHOT_ON, OpenWeatherSnapshot.cpp
+    void saveResults(struct weatherSnapshot &set);
+    void loadResults(const struct weatherSnapshot &set);
+    void publishResults(void);
+    void beginSnapshot(void);
+    void endSnapshot(int error_code);
+    int snapshotMode = SNAPSHOT_OFF;
+    std::atomic<unsigned long> snapshotSeq{0}; // one more for every publish
+    std::atomic<int> snapshotPins[2]{}; // views held, by the parity of seq
+    void waitSnapshotPins(int set);
+    struct weatherSnapshot published[2] = {}; // by the parity of seq
+    struct weatherSnapshot spare = {}; // filled by the next refresh
 
     std::function<long()> EpochTimeCallback = NULL;
 
+    // parseWeatherAsync(), OpenWeatherAsync.cpp
+    static void asyncTask(void *owoc);
+    std::function<void(int)> AsyncDoneCallback = NULL;
+    std::atomic<bool> asyncBusy{false};
+    std::atomic<int> asyncResult{0};
+
+    // Response cache, OpenWeatherCache.cpp
+    struct requestKey
+    {
+        float latitude;
+        float longitude;
+        int units;
+        int excludes;
+        int history;
+        int dateFormat;
+        int series;  // setSeries()
+        int days;    // setHorizon()
+        int hours;
+        int minutes;
+        char language[6];
+    };
+    int fetchWeather(void);
+    void makeRequestKey(struct requestKey &key);
+    int cacheLookup(void);
+    void cacheStore(const struct requestKey &key, int error_code);
+    struct requestKey cacheKey;
+    bool cacheValid = false;
+    unsigned long cacheTime = 0;
+    unsigned long cacheTTL = 0;   // ms, 0: no cache
+    unsigned long cacheStale = 0; // ms
+    std::atomic<int> cacheStatus{CACHE_MISS};
+    std::atomic<bool> cacheServing{false}; // the async refresh is for a stale entry, which stays published
+
+    LocationCache ownLocations;
+    LocationCache *locations = &ownLocations;
+    int reverseGeocode = GEOCODE_ONLINE;
+    int seriesMode = SERIES_OFF;
+
+    // readableDateTime() and friends, round robin
+    struct dateText
+    {
+        long epoch; // timezone offset included
+        int format;
+        char text[20];
+    } dateCache[DATE_CACHE_SIZE] = {};
+    int dateNext = 0;
+
+    // CONCURRENT_FETCH
+    static void aqTask(void *owoc);
+    OpenWeatherSession aqSession;
+    SemaphoreHandle_t aqJoin = NULL;
+    int aqOffset = 0; // timezone offset from before the refresh
+    int aqResult = 0;
+
+    OpenWeatherArena arena; // inactive unless setArena()
+    bool arenaFit = false;  // setArena(void)
+    bool storageFixed = false; // setStorage(), the arena is the object's own buffer
+    // Most entries setHorizon() accepts
+    int dayCapacity = ONECALL_DAYS;
+    int hourCapacity = ONECALL_HOURS;
+    int minuteCapacity = ONECALL_MINUTES;
+    int alertCapacity = ONECALL_ALERTS;
+    int horizonExcludes(void);
+    OpenWeatherSession session;
+
    //Variables
     // For eventual struct calls
     struct apiInfo
@@ -298,11 +595,27 @@ private:
         int OPEN_WEATHER_UNITS = 2;
         int OPEN_WEATHER_EXCLUDES = 0;
         int OPEN_WEATHER_HISTORY = 0;
+        int OPEN_WEATHER_PARSER = DOM_PARSER;
+        int OPEN_WEATHER_FETCH = SEQUENTIAL_FETCH;
     } USER_PARAM;
 
 
     char units[10] = "IMPERIAL";
-    char _ipapiURL[38];
+    char _ipapiURL[70]; // Room for an IPv6 address
+
+    // Last setLatLon(void) result
+    struct
+    {
+        float latitude;
+        float longitude;
+        char CITY[60];
+        char STATE[10];
+        char COUNTRY[10];
+        unsigned long time;
+        bool valid = false;
+    } ipLocation;
+    int ipLookup = IP_ONE_STEP;
+    unsigned long ipLocationTTL = IP_LOCATION_TTL * 1000UL;
     int summary_len = 0;
 
     //BITFIELDS for exclude flags
@@ -316,7 +629,7 @@ private:
             uint8_t hourly : 1;
             uint8_t minutely : 1;
             uint8_t alerts : 1;
-            uint8_t Spare2 : 1;
+            uint8_t quality : 1;
             uint8_t Spare1 : 1;
         };
         uint8_t all_excludes;
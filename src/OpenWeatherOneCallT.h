@@ -0,0 +1,72 @@
+/*
+   OpenWeatherOneCallT.h
+   OpenWeatherOneCall with the result arrays sized at compile time and
+   kept inside the object, results never come from the heap:
+
+       OpenWeatherOneCallT<3, 12, 0, 2> OWOC; // 3 days, 12 hours, no minutely, 2 alerts
+
+   A size of 0 excludes that section from every request and takes no
+   space, setHorizon() shortens the others at run time. The result
+   structs are laid out in the object's own buffer through the arena
+   (see OpenWeatherArena.h), which is sized for all of them, so they
+   can't fail to allocate, the WeatherSeries of setSeries(SERIES_ON)
+   included when there are hours or minutes. Strings that are not in
+   the condition tables (alert texts, other languages) share TextBytes;
+   only running out of those returns 23.
+
+   STREAM_PARSER is preset. The JsonDocument of DOM_PARSER, history and
+   air quality, and the token buffer of the stream reader still use the
+   heap. Snapshots need a second result set and are not available,
+   setArena() returns 37.
+*/
+
+#ifndef _OPEN_WEATHER_ONECALL_T_H
+#define _OPEN_WEATHER_ONECALL_T_H
+
+#include "OpenWeatherOneCall.h"
+
+#define STATIC_TEXT_BYTES 1024 // default TextBytes
+
+template <int Days, int Hours, int Minutes, int MaxAlerts, size_t TextBytes = STATIC_TEXT_BYTES>
+class OpenWeatherOneCallT : public OpenWeatherOneCall
+{
+    static_assert((Days >= 0) && (Days <= ONECALL_DAYS), "Days: 0 to ONECALL_DAYS");
+    static_assert((Hours >= 0) && (Hours <= ONECALL_HOURS), "Hours: 0 to ONECALL_HOURS");
+    static_assert((Minutes >= 0) && (Minutes <= ONECALL_MINUTES), "Minutes: 0 to ONECALL_MINUTES");
+    static_assert((MaxAlerts >= 0) && (MaxAlerts <= ONECALL_ALERTS), "MaxAlerts: 0 to ONECALL_ALERTS");
+
+public:
+    static constexpr int DAYS = Days;
+    static constexpr int HOURS = Hours;
+    static constexpr int MINUTES = Minutes;
+    static constexpr int MAX_ALERTS = MaxAlerts;
+
+    OpenWeatherOneCallT()
+    {
+        OpenWeatherOneCall::setStorage(storage, sizeof(storage), Days, Hours, Minutes, MaxAlerts);
+        OpenWeatherOneCall::setParser(STREAM_PARSER);
+    }
+
+private:
+    static constexpr size_t block(size_t bytes)
+    {
+        return (bytes + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+    }
+
+    static constexpr size_t SERIES_SIZE = (Hours || Minutes) ? block(sizeof(WeatherSeries)) : 0;
+#ifdef OWOC_SPLIT_RECORDS
+    static constexpr size_t RECORD_TEXT_SIZE = block(Days * sizeof(recordText)) + block(sizeof(recordText));
+#else
+    static constexpr size_t RECORD_TEXT_SIZE = 0;
+#endif
+
+    // Every block one refresh takes from the arena, plus the alignment the buffer may need
+    static constexpr size_t STORAGE_SIZE =
+        block(sizeof(nowData)) + block(Days * sizeof(futureData)) + block(Hours * sizeof(HOURLY)) +
+        block(Minutes * sizeof(MINUTELY)) + block(MaxAlerts * sizeof(ALERTS)) + block(sizeof(airQuality)) +
+        block(sizeof(HISTORICAL)) + RECORD_TEXT_SIZE + SERIES_SIZE + block(TextBytes) + ARENA_ALIGN;
+
+    alignas(ARENA_ALIGN) char storage[STORAGE_SIZE];
+};
+
+#endif
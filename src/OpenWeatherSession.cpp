@@ -0,0 +1,63 @@
+/*
+   OpenWeatherSession.cpp
+   Keep-alive connection, see OpenWeatherSession.h
+*/
+
+#include "OpenWeatherSession.h"
+
+OpenWeatherSession::OpenWeatherSession() :
+    _idle(KEEPALIVE_REFRESH), _lastUse(0)
+{
+    // Same as HTTPClient::begin(url), the server certificate is not checked
+    _client.setInsecure();
+}
+
+void OpenWeatherSession::setIdle(long idleMs)
+{
+    _idle = idleMs;
+    if(_idle < 0) OpenWeatherSession::close();
+}
+
+int OpenWeatherSession::request(HTTPClient &http, const char *url)
+{
+    http.useHTTP10(true); // To enable http.getStream(), no chunked bodies
+
+    if((_idle < 0) || strncmp(url,SESSION_HOST,strlen(SESSION_HOST)))
+        {
+            http.begin(url);
+            return http.GET();
+        }
+
+    if(_client.connected() && (_idle > 0) && (millis() - _lastUse > (unsigned long)_idle))
+        {
+            _client.stop();
+        }
+
+    bool reused = _client.connected();
+    http.setReuse(true); // Sends keep-alive, useHTTP10() turned it off
+    http.begin(_client,url);
+    int httpCode = http.GET();
+
+    // The server may have dropped the connection while it sat idle
+    if((httpCode < 0) && reused)
+        {
+            http.end();
+            _client.stop();
+            http.setReuse(true);
+            http.begin(_client,url);
+            httpCode = http.GET();
+        }
+
+    _lastUse = millis();
+    return httpCode;
+}
+
+void OpenWeatherSession::endRefresh(void)
+{
+    if(_idle <= 0) OpenWeatherSession::close();
+}
+
+void OpenWeatherSession::close(void)
+{
+    _client.stop();
+}
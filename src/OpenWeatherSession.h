@@ -0,0 +1,45 @@
+/*
+   OpenWeatherSession.h
+   One keep-alive TLS connection to api.openweathermap.org shared by the
+   AQ, One Call and history requests. Only the first request of a
+   refresh pays for the handshake; with an idle window the connection
+   also carries over to the next refresh.
+
+   An open connection keeps the TLS buffers allocated (tens of KB on the
+   ESP32), KEEPALIVE_REFRESH releases them at the end of every refresh.
+*/
+
+#ifndef _OPEN_WEATHER_SESSION_H
+#define _OPEN_WEATHER_SESSION_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+
+#define KEEPALIVE_OFF -1    // A new connection per request
+#define KEEPALIVE_REFRESH 0 // One connection per refresh, default
+// > 0: kept between refreshes for that many ms of idle time
+
+#define SESSION_HOST "https://api.openweathermap.org/"
+
+class OpenWeatherSession
+{
+public:
+    OpenWeatherSession();
+
+    void setIdle(long idleMs);
+
+    // begin() + GET() on the shared connection, other hosts get their own.
+    // A dropped keep-alive connection is reopened once.
+    int request(HTTPClient &http, const char *url);
+
+    void endRefresh(void); // Closes unless an idle window is set
+    void close(void);
+
+private:
+    WiFiClientSecure _client;
+    long _idle;
+    unsigned long _lastUse;
+};
+
+#endif
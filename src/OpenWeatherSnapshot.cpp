@@ -0,0 +1,161 @@
+/*
+   OpenWeatherSnapshot.cpp
+   SNAPSHOT_ON: a refresh fills a second result set (current, forecast,
+   hour, minute, series, alert, quality, history) while the last complete one
+   stays untouched. Only a refresh that returns 0 replaces it; after a
+   failure the public pointers are back on the last complete results.
+
+   Another task reads without a lock, reading again when a refresh
+   published meanwhile:
+
+       OpenWeatherOneCall::weatherSnapshot view;
+       unsigned long seq;
+       do {
+           seq = OWOC.readSnapshot(view);
+           temperature = view.current ? view.current->temperature : 0;
+       } while(OWOC.snapshotChanged(seq));
+
+   The view, strings included, stays valid until snapshotChanged(seq):
+   readSnapshot() pins its set and snapshotChanged() releases it, so
+   call it once for every readSnapshot(). The next refresh fills the
+   other set; the one after it reuses the pinned set and waits until
+   the view is released. A task holding a view must not refresh twice.
+   published keeps one view per parity of seq, so it is never written
+   while a reader copies it either.
+
+   The refreshing task itself keeps using OWOC.current and the others.
+   location is still updated in place. Both sets stay allocated, so
+   results take twice the heap; the arena holds one refresh only and
+   can't be combined with snapshots.
+*/
+
+#include "OpenWeatherOneCall.h"
+
+int OpenWeatherOneCall::setSnapshots(int _MODE)
+{
+    if((_MODE != SNAPSHOT_OFF) && (_MODE != SNAPSHOT_ON)) return 35;
+    if(asyncBusy) return 28;
+    if((_MODE == SNAPSHOT_ON) && arena.active()) return 34;
+    if(_MODE == snapshotMode) return 0;
+    if(cacheStale) return 40; // setCache() stale window, see OpenWeatherCache.cpp
+
+    if(_MODE == SNAPSHOT_OFF)
+        {
+            // Free the spare set through the member pointers; with SNAPSHOT_OFF the
+            // published set is refreshed in place, so no view may be left on either
+            OpenWeatherOneCall::waitSnapshotPins(0);
+            OpenWeatherOneCall::waitSnapshotPins(1);
+            struct weatherSnapshot results;
+            OpenWeatherOneCall::saveResults(results);
+            OpenWeatherOneCall::loadResults(spare);
+            OpenWeatherOneCall::freeResultMem();
+            OpenWeatherOneCall::loadResults(results);
+            spare = {};
+        }
+
+    snapshotMode = _MODE;
+    OpenWeatherOneCall::publishResults();
+    return 0;
+}
+
+unsigned long OpenWeatherOneCall::readSnapshot(struct weatherSnapshot &view)
+{
+    unsigned long seq;
+    for(;;)
+        {
+            seq = snapshotSeq.load();
+            // Pinned before it is reused only if no refresh published meanwhile
+            snapshotPins[seq & 1].fetch_add(1);
+            if(snapshotSeq.load() == seq) break;
+            snapshotPins[seq & 1].fetch_sub(1);
+        }
+    view = published[seq & 1];
+    return seq;
+}
+
+// Also releases the view of readSnapshot()
+bool OpenWeatherOneCall::snapshotChanged(unsigned long seq)
+{
+    bool changed = snapshotSeq.load(std::memory_order_acquire) != seq;
+    snapshotPins[seq & 1].fetch_sub(1, std::memory_order_release);
+    return changed;
+}
+
+// Until no view is left on the set published at a seq of this parity
+void OpenWeatherOneCall::waitSnapshotPins(int set)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst); // after the publish, see readSnapshot()
+    while(snapshotPins[set].load(std::memory_order_acquire)) delay(1);
+}
+
+void OpenWeatherOneCall::saveResults(struct weatherSnapshot &set)
+{
+    set.current = current;
+    set.forecast = forecast;
+    set.hour = hour;
+    set.minute = minute;
+    set.series = series;
+    set.alert = alert;
+    set.MAX_NUM_ALERTS = MAX_NUM_ALERTS;
+    set.quality = quality;
+    set.history = history;
+#ifdef OWOC_SPLIT_RECORDS
+    set.forecastText = forecastText;
+    set.historyText = historyText;
+#endif
+}
+
+void OpenWeatherOneCall::loadResults(const struct weatherSnapshot &set)
+{
+    current = set.current;
+    forecast = set.forecast;
+    hour = set.hour;
+    minute = set.minute;
+    series = set.series;
+    alert = set.alert;
+    MAX_NUM_ALERTS = set.MAX_NUM_ALERTS;
+    quality = set.quality;
+    history = set.history;
+#ifdef OWOC_SPLIT_RECORDS
+    forecastText = set.forecastText;
+    historyText = set.historyText;
+#endif
+}
+
+// The member pointers become what readSnapshot() returns, empty with SNAPSHOT_OFF
+void OpenWeatherOneCall::publishResults(void)
+{
+    unsigned long seq = snapshotSeq.load(std::memory_order_relaxed) + 1;
+    OpenWeatherOneCall::waitSnapshotPins(seq & 1);
+
+    if(snapshotMode == SNAPSHOT_ON) OpenWeatherOneCall::saveResults(published[seq & 1]);
+    else published[seq & 1] = {};
+
+    snapshotSeq.store(seq, std::memory_order_release);
+}
+
+// Start of the parse: the member pointers move to the spare set
+void OpenWeatherOneCall::beginSnapshot(void)
+{
+    if(snapshotMode != SNAPSHOT_ON) return;
+    // The spare set was published one seq before the current one
+    OpenWeatherOneCall::waitSnapshotPins((snapshotSeq.load(std::memory_order_relaxed) + 1) & 1);
+    OpenWeatherOneCall::loadResults(spare);
+}
+
+void OpenWeatherOneCall::endSnapshot(int error_code)
+{
+    if(snapshotMode != SNAPSHOT_ON) return;
+
+    if(error_code)
+        {
+            // The partial set is reused by the next refresh
+            OpenWeatherOneCall::saveResults(spare);
+            OpenWeatherOneCall::loadResults(published[snapshotSeq.load(std::memory_order_relaxed) & 1]);
+            return;
+        }
+
+    // Views still on the old set keep it until they are released
+    spare = published[snapshotSeq.load(std::memory_order_relaxed) & 1];
+    OpenWeatherOneCall::publishResults();
+}
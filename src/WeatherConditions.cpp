@@ -0,0 +1,164 @@
+/*
+   WeatherConditions.cpp
+   Condition table, see WeatherConditions.h
+   https://openweathermap.org/weather-conditions
+*/
+
+#include "WeatherConditions.h"
+
+// Sorted by id
+static const WeatherCondition weatherConditions[] PROGMEM =
+{
+    {200, "Thunderstorm", "thunderstorm with light rain"},
+    {201, "Thunderstorm", "thunderstorm with rain"},
+    {202, "Thunderstorm", "thunderstorm with heavy rain"},
+    {210, "Thunderstorm", "light thunderstorm"},
+    {211, "Thunderstorm", "thunderstorm"},
+    {212, "Thunderstorm", "heavy thunderstorm"},
+    {221, "Thunderstorm", "ragged thunderstorm"},
+    {230, "Thunderstorm", "thunderstorm with light drizzle"},
+    {231, "Thunderstorm", "thunderstorm with drizzle"},
+    {232, "Thunderstorm", "thunderstorm with heavy drizzle"},
+    {300, "Drizzle", "light intensity drizzle"},
+    {301, "Drizzle", "drizzle"},
+    {302, "Drizzle", "heavy intensity drizzle"},
+    {310, "Drizzle", "light intensity drizzle rain"},
+    {311, "Drizzle", "drizzle rain"},
+    {312, "Drizzle", "heavy intensity drizzle rain"},
+    {313, "Drizzle", "shower rain and drizzle"},
+    {314, "Drizzle", "heavy shower rain and drizzle"},
+    {321, "Drizzle", "shower drizzle"},
+    {500, "Rain", "light rain"},
+    {501, "Rain", "moderate rain"},
+    {502, "Rain", "heavy intensity rain"},
+    {503, "Rain", "very heavy rain"},
+    {504, "Rain", "extreme rain"},
+    {511, "Rain", "freezing rain"},
+    {520, "Rain", "light intensity shower rain"},
+    {521, "Rain", "shower rain"},
+    {522, "Rain", "heavy intensity shower rain"},
+    {531, "Rain", "ragged shower rain"},
+    {600, "Snow", "light snow"},
+    {601, "Snow", "snow"},
+    {602, "Snow", "heavy snow"},
+    {611, "Snow", "sleet"},
+    {612, "Snow", "light shower sleet"},
+    {613, "Snow", "shower sleet"},
+    {615, "Snow", "light rain and snow"},
+    {616, "Snow", "rain and snow"},
+    {620, "Snow", "light shower snow"},
+    {621, "Snow", "shower snow"},
+    {622, "Snow", "heavy shower snow"},
+    {701, "Mist", "mist"},
+    {711, "Smoke", "smoke"},
+    {721, "Haze", "haze"},
+    {731, "Dust", "sand/dust whirls"},
+    {741, "Fog", "fog"},
+    {751, "Sand", "sand"},
+    {761, "Dust", "dust"},
+    {762, "Ash", "volcanic ash"},
+    {771, "Squall", "squalls"},
+    {781, "Tornado", "tornado"},
+    {800, "Clear", "clear sky"},
+    {801, "Clouds", "few clouds"},
+    {802, "Clouds", "scattered clouds"},
+    {803, "Clouds", "broken clouds"},
+    {804, "Clouds", "overcast clouds"}
+};
+
+#define NUM_CONDITIONS (sizeof(weatherConditions) / sizeof(weatherConditions[0]))
+
+// "weather":[{"icon":...}], d for day and n for night
+static const char weatherIcons[][4] PROGMEM =
+{
+    "01d", "01n", "02d", "02n", "03d", "03n", "04d", "04n", "09d",
+    "09n", "10d", "10n", "11d", "11n", "13d", "13n", "50d", "50n"
+};
+
+#define NUM_ICONS (sizeof(weatherIcons) / sizeof(weatherIcons[0]))
+
+const WeatherCondition *findCondition(int id)
+{
+    int low = 0;
+    int high = NUM_CONDITIONS - 1;
+
+    while(low <= high)
+        {
+            int middle = (low + high) / 2;
+            if(weatherConditions[middle].id == id) return &weatherConditions[middle];
+            if(weatherConditions[middle].id > id) high = middle - 1;
+            else low = middle + 1;
+        }
+    return NULL;
+}
+
+bool isConditionText(const char *text)
+{
+    uintptr_t address = (uintptr_t)text;
+    return ((address >= (uintptr_t)weatherConditions) && (address < (uintptr_t)(weatherConditions + NUM_CONDITIONS))) ||
+           ((address >= (uintptr_t)weatherIcons) && (address < (uintptr_t)(weatherIcons + NUM_ICONS)));
+}
+
+// Text that is in neither table goes to the arena (NULL: heap)
+static int copyConditionText(char *&dest, const char *text, size_t length, OpenWeatherArena *arena)
+{
+    if(arena)
+        {
+            dest = arena->copyText(text, length);
+            return (dest == NULL) ? 23 : 0;
+        }
+    if(isConditionText(dest)) dest = NULL;
+    dest = (char *)realloc(dest, sizeof(char) * length + 1);
+    if(dest == NULL) return 23;
+    memcpy(dest, text, length + 1);
+    return 0;
+}
+
+static const char *matchText(const WeatherCondition *condition, const char *text, bool description)
+{
+    const char *interned = description ? condition->description : condition->main;
+    return strcmp(interned, text) ? NULL : interned;
+}
+
+int storeConditionText(char *&dest, int id, const char *text, size_t length, bool description, OpenWeatherArena *arena)
+{
+    const char *interned = NULL;
+    const WeatherCondition *condition = findCondition(id);
+    if(condition) interned = matchText(condition, text, description);
+
+    // id normally comes first in weather[0], search by text when it has not been read yet
+    for(size_t c = 0; (id == 0) && !interned && (c < NUM_CONDITIONS); c++)
+        {
+            interned = matchText(&weatherConditions[c], text, description);
+        }
+
+    if(interned)
+        {
+            freeConditionText(dest, arena);
+            dest = (char *)interned;
+            return 0;
+        }
+
+    // Another language or an unknown code
+    return copyConditionText(dest, text, length, arena);
+}
+
+int storeIconText(char *&dest, const char *text, size_t length, OpenWeatherArena *arena)
+{
+    for(size_t i = 0; i < NUM_ICONS; i++)
+        {
+            if(!strcmp(weatherIcons[i], text))
+                {
+                    freeConditionText(dest, arena);
+                    dest = (char *)weatherIcons[i];
+                    return 0;
+                }
+        }
+    return copyConditionText(dest, text, length, arena);
+}
+
+void freeConditionText(char *&text, OpenWeatherArena *arena)
+{
+    if(text && !isConditionText(text) && !(arena && arena->owns(text))) free(text);
+    text = NULL;
+}
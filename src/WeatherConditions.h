@@ -0,0 +1,38 @@
+/*
+   WeatherConditions.h
+   OpenWeather condition codes (weather[0].id) with their English main
+   and description text, kept in flash, and the icon codes. main, summary
+   and icon in the result structs point into these tables when the text
+   matches, so a refresh does not allocate for them. Other text (another
+   language, an unknown code) is copied to the heap as before.
+*/
+
+#ifndef _WEATHER_CONDITIONS_H
+#define _WEATHER_CONDITIONS_H
+
+#include <Arduino.h>
+#include "OpenWeatherArena.h"
+
+struct WeatherCondition
+{
+    uint16_t id;
+    char main[14];
+    char description[32];
+};
+
+// NULL for an unknown code
+const WeatherCondition *findCondition(int id);
+
+// True when text points into the condition or icon table (never freed)
+bool isConditionText(const char *text);
+
+// Point dest at the table text for id, or copy text to the arena (NULL: heap)
+int storeConditionText(char *&dest, int id, const char *text, size_t length, bool description, OpenWeatherArena *arena);
+
+// Point dest at the icon table entry for text, or copy it like storeConditionText()
+int storeIconText(char *&dest, const char *text, size_t length, OpenWeatherArena *arena);
+
+// Free a heap copy, table and arena text is left alone
+void freeConditionText(char *&text, OpenWeatherArena *arena);
+
+#endif
@@ -0,0 +1,131 @@
+/*
+   WeatherSeries.cpp
+   Reductions over float arrays, see WeatherSeries.h
+*/
+
+#include "WeatherSeries.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SERIES_SSE
+#endif
+
+float seriesMin(const float *values, int count)
+{
+    if(count <= 0) return 0;
+    int i = 0;
+    float low = values[0];
+#ifdef SERIES_SSE
+    if(count >= 4)
+        {
+            __m128 lanes = _mm_loadu_ps(values);
+            for(i = 4; i + 4 <= count; i += 4) lanes = _mm_min_ps(lanes, _mm_loadu_ps(values + i));
+            lanes = _mm_min_ps(lanes, _mm_movehl_ps(lanes, lanes));
+            lanes = _mm_min_ss(lanes, _mm_shuffle_ps(lanes, lanes, 1));
+            low = _mm_cvtss_f32(lanes);
+        }
+#else
+    float lanes[4] = {low, low, low, low};
+    for(; i + 4 <= count; i += 4)
+        {
+            for(int l = 0; l < 4; l++) lanes[l] = (values[i + l] < lanes[l]) ? values[i + l] : lanes[l];
+        }
+    for(int l = 0; l < 4; l++) low = (lanes[l] < low) ? lanes[l] : low;
+#endif
+    for(; i < count; i++) low = (values[i] < low) ? values[i] : low;
+    return low;
+}
+
+float seriesMax(const float *values, int count)
+{
+    if(count <= 0) return 0;
+    int i = 0;
+    float high = values[0];
+#ifdef SERIES_SSE
+    if(count >= 4)
+        {
+            __m128 lanes = _mm_loadu_ps(values);
+            for(i = 4; i + 4 <= count; i += 4) lanes = _mm_max_ps(lanes, _mm_loadu_ps(values + i));
+            lanes = _mm_max_ps(lanes, _mm_movehl_ps(lanes, lanes));
+            lanes = _mm_max_ss(lanes, _mm_shuffle_ps(lanes, lanes, 1));
+            high = _mm_cvtss_f32(lanes);
+        }
+#else
+    float lanes[4] = {high, high, high, high};
+    for(; i + 4 <= count; i += 4)
+        {
+            for(int l = 0; l < 4; l++) lanes[l] = (values[i + l] > lanes[l]) ? values[i + l] : lanes[l];
+        }
+    for(int l = 0; l < 4; l++) high = (lanes[l] > high) ? lanes[l] : high;
+#endif
+    for(; i < count; i++) high = (values[i] > high) ? values[i] : high;
+    return high;
+}
+
+// Four partial sums, added pairwise at the end on every path
+float seriesSum(const float *values, int count)
+{
+    int i = 0;
+#ifdef SERIES_SSE
+    __m128 lanes = _mm_setzero_ps();
+    for(; i + 4 <= count; i += 4) lanes = _mm_add_ps(lanes, _mm_loadu_ps(values + i));
+    float partial[4];
+    _mm_storeu_ps(partial, lanes);
+#else
+    float partial[4] = {0, 0, 0, 0};
+    for(; i + 4 <= count; i += 4)
+        {
+            for(int l = 0; l < 4; l++) partial[l] += values[i + l];
+        }
+#endif
+    float total = (partial[0] + partial[2]) + (partial[1] + partial[3]);
+    for(; i < count; i++) total += values[i];
+    return total;
+}
+
+float seriesMean(const float *values, int count)
+{
+    return (count > 0) ? seriesSum(values, count) / count : 0;
+}
+
+int seriesArgMax(const float *values, int count)
+{
+    if(count <= 0) return -1;
+    float high = seriesMax(values, count);
+    for(int i = 0; i < count; i++)
+        {
+            if(values[i] == high) return i;
+        }
+    return 0;
+}
+
+int seriesFirstAbove(const float *values, int count, float threshold)
+{
+    int i = 0;
+#ifdef SERIES_SSE
+    __m128 limit = _mm_set1_ps(threshold);
+    for(; i + 4 <= count; i += 4)
+        {
+            int above = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(values + i), limit));
+            if(above) return i + __builtin_ctz(above);
+        }
+#endif
+    for(; i < count; i++)
+        {
+            if(values[i] > threshold) return i;
+        }
+    return -1;
+}
+
+// Running sum, corrected every window so rounding doesn't build up
+int seriesWindowSums(const float *values, int count, int width, float *sums)
+{
+    if((width <= 0) || (count < width)) return 0;
+
+    int windows = count - width + 1;
+    for(int w = 0; w < windows; w++)
+        {
+            sums[w] = (w % width) ? sums[w - 1] + values[w + width - 1] - values[w - 1] : seriesSum(values + w, width);
+        }
+    return windows;
+}
@@ -0,0 +1,51 @@
+/*
+   WeatherSeries.h
+   Hourly and minutely values of a refresh as one array per field, so a
+   scan over 48 temperatures or 61 precipitation values reads
+   contiguous floats instead of striding over HOURLY (about 100 bytes
+   an entry). Filled after the parse when setSeries(SERIES_ON), with
+   OWOC_FIXED_POINT the values are converted back to float here.
+
+   The kernels work on any float array: SSE on x86 hosts, four
+   independent accumulators elsewhere (the ESP32 FPU is scalar).
+*/
+
+#ifndef _WEATHER_SERIES_H
+#define _WEATHER_SERIES_H
+
+#include <Arduino.h>
+
+#define SERIES_HOURS 48
+#define SERIES_MINUTES 61
+
+struct WeatherSeries
+{
+    int hours;         // Valid hourly entries, 0 when hourly is excluded
+    int minutes;       // Valid minutely entries
+    long hourStart;    // dayTime of the first hour
+    long minuteStart;  // dayTime of the first minute
+
+    float temperature[SERIES_HOURS];
+    float apparentTemperature[SERIES_HOURS];
+    float pop[SERIES_HOURS];
+    float rainVolume[SERIES_HOURS];
+    float snowVolume[SERIES_HOURS];
+    float windSpeed[SERIES_HOURS];
+    float pressure[SERIES_HOURS];
+    float humidity[SERIES_HOURS];
+    float cloudCover[SERIES_HOURS];
+    float precipitation[SERIES_MINUTES];
+};
+
+// 0 (argmax, first above: -1) for an empty range
+float seriesMin(const float *values, int count);
+float seriesMax(const float *values, int count);
+float seriesSum(const float *values, int count);
+float seriesMean(const float *values, int count);
+int seriesArgMax(const float *values, int count);             // first index of the maximum
+int seriesFirstAbove(const float *values, int count, float threshold);
+
+// Sums of every window of width values, sums[count - width + 1]; returns how many
+int seriesWindowSums(const float *values, int count, int width, float *sums);
+
+#endif
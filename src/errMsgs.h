@@ -28,6 +28,20 @@ const char string_22[] PROGMEM = "MALLOC FAIL";
 const char string_23[] PROGMEM = "LAT/LON NOT SET";
 const char string_24[] PROGMEM = "deserializeJsonJSON failed";
 const char string_25[] PROGMEM = "OpenWeather account temporary blocked";
+const char string_26[] PROGMEM = "Invalid parser type";
+const char string_27[] PROGMEM = "Refresh already running";
+const char string_28[] PROGMEM = "Invalid fetch mode";
+const char string_29[] PROGMEM = "Location precision out of range";
+const char string_30[] PROGMEM = "Invalid IP location mode";
+const char string_31[] PROGMEM = "Offline city table has no names";
+const char string_32[] PROGMEM = "Invalid reverse geocode mode";
+const char string_33[] PROGMEM = "Snapshots and the arena exclude each other";
+const char string_34[] PROGMEM = "Invalid snapshot mode";
+const char string_35[] PROGMEM = "Invalid series mode";
+const char string_36[] PROGMEM = "Result storage is fixed by OpenWeatherOneCallT";
+const char string_37[] PROGMEM = "Invalid horizon";
+const char string_38[] PROGMEM = "Horizon can't change while snapshots are on";
+const char string_39[] PROGMEM = "A stale cache window needs snapshots";
 
 const char *const errorMsgs[] PROGMEM =
 {
@@ -56,7 +70,21 @@ const char *const errorMsgs[] PROGMEM =
   string_22,
   string_23,
   string_24,
-  string_25
+  string_25,
+  string_26,
+  string_27,
+  string_28,
+  string_29,
+  string_30,
+  string_31,
+  string_32,
+  string_33,
+  string_34,
+  string_35,
+  string_36,
+  string_37,
+  string_38,
+  string_39
 };
 
 
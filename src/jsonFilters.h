@@ -0,0 +1,54 @@
+#ifndef JSONFILTERS_H_INCLUDED
+#define JSONFILTERS_H_INCLUDED
+
+// ArduinoJson filters: only the members the result structs consume are kept
+// in the JsonDocument. Single quotes are accepted by ArduinoJson.
+
+#define FILTER_WEATHER "'weather':[{'id':true,'main':true,'description':true,'icon':true}]"
+
+// One Call, assembled from the sections that are not excluded
+const char filter_onecall_head[] PROGMEM = "{'timezone':true,'timezone_offset':true";
+
+const char filter_onecall_current[] PROGMEM = ",'current':{'dt':true,'sunrise':true,'sunset':true,'temp':true,"
+        "'feels_like':true,'pressure':true,'humidity':true,'dew_point':true,'uvi':true,'clouds':true,"
+        "'visibility':true,'wind_speed':true,'wind_deg':true,'wind_gust':true,'snow':{'1h':true},"
+        "'rain':{'1h':true}," FILTER_WEATHER "}";
+
+const char filter_onecall_daily[] PROGMEM = ",'daily':[{'dt':true,'sunrise':true,'sunset':true,"
+        "'temp':{'day':true,'min':true,'max':true,'night':true,'eve':true,'morn':true},"
+        "'feels_like':{'day':true,'night':true,'eve':true,'morn':true},'pressure':true,'humidity':true,"
+        "'dew_point':true,'wind_speed':true,'wind_gust':true,'wind_deg':true," FILTER_WEATHER ","
+        "'clouds':true,'pop':true,'rain':true,'snow':true,'uvi':true}]";
+
+const char filter_onecall_hourly[] PROGMEM = ",'hourly':[{'dt':true,'temp':true,'feels_like':true,"
+        "'pressure':true,'humidity':true,'dew_point':true,'clouds':true,'visibility':true,'wind_speed':true,"
+        "'wind_deg':true,'snow':{'1h':true},'rain':{'1h':true}," FILTER_WEATHER ",'pop':true}]";
+
+const char filter_onecall_minutely[] PROGMEM = ",'minutely':[{'dt':true,'precipitation':true}]";
+
+const char filter_onecall_alerts[] PROGMEM = ",'alerts':[{'sender_name':true,'event':true,'start':true,"
+        "'end':true,'description':true}]";
+
+// History: timestamp lookup, timemachine and daily aggregation
+const char filter_epoch[] PROGMEM = "{'current':{'dt':true}}";
+
+const char filter_timemachine[] PROGMEM = "{'timezone':true,'timezone_offset':true,'data':[{'dt':true,"
+        "'sunrise':true,'sunset':true,'temp':true,'feels_like':true,'pressure':true,'humidity':true,"
+        "'dew_point':true,'uvi':true,'clouds':true,'visibility':true,'wind_speed':true,'wind_deg':true,"
+        "'wind_gust':true,'rain':{'1h':true},'snow':{'1h':true}," FILTER_WEATHER "}]}";
+
+const char filter_day_summary[] PROGMEM = "{'cloud_cover':{'afternoon':true},'humidity':{'afternoon':true},"
+        "'precipitation':{'total':true},'pressure':{'afternoon':true},'temperature':{'min':true,'max':true,"
+        "'night':true,'morning':true,'afternoon':true,'evening':true},'wind':{'max':{'speed':true,'direction':true}}}";
+
+// Air quality, reverse geocode, CITY ID and IP location
+const char filter_air_pollution[] PROGMEM = "{'list':[{'dt':true,'main':{'aqi':true},'components':{'co':true,"
+        "'no':true,'no2':true,'o3':true,'so2':true,'pm2_5':true,'pm10':true,'nh3':true}}]}";
+
+const char filter_reverse_geocode[] PROGMEM = "{'locality':true,'principalSubdivisionCode':true,'countryCode':true}";
+
+const char filter_city[] PROGMEM = "{'coord':{'lat':true,'lon':true}}";
+
+const char filter_ipapi[] PROGMEM = "{'city':true,'region_code':true,'country_code':true,'latitude':true,'longitude':true}";
+
+#endif // JSONFILTERS_H_INCLUDED